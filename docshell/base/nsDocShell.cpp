@@ -8247,12 +8247,60 @@ nsDocShell::ForceCreateAboutBlankContentViewer(nsIPrincipal* aPrincipal)
   return CreateAboutBlankContentViewer(aPrincipal, nullptr, true, false);
 }
 
+/* static */ void
+nsDocShell::AccumulateSavePresentationResult(SavePresentationResult aResult)
+{
+  typedef Telemetry::LABELS_BFCACHE_SAVE_PRESENTATION_RESULT Label;
+  Label label;
+  switch (aResult) {
+    case SavePresentationResult::NoEntry:
+      label = Label::NoEntry;
+      break;
+    case SavePresentationResult::HasViewer:
+      label = Label::HasViewer;
+      break;
+    case SavePresentationResult::LoadType:
+      label = Label::LoadType;
+      break;
+    case SavePresentationResult::NoLayoutState:
+      label = Label::NoLayoutState;
+      break;
+    case SavePresentationResult::Loading:
+      label = Label::Loading;
+      break;
+    case SavePresentationResult::ReusesInnerWindow:
+      label = Label::ReusesInnerWindow;
+      break;
+    case SavePresentationResult::CacheDisabled:
+      label = Label::CacheDisabled;
+      break;
+    case SavePresentationResult::Subframe:
+      label = Label::Subframe;
+      break;
+    case SavePresentationResult::DocumentRefused:
+      label = Label::DocumentRefused;
+      break;
+    case SavePresentationResult::Saved:
+      label = Label::Saved;
+      break;
+    default:
+      MOZ_ASSERT_UNREACHABLE("Unknown SavePresentationResult");
+      return;
+  }
+  Telemetry::AccumulateCategorical(label);
+}
+
 bool
 nsDocShell::CanSavePresentation(uint32_t aLoadType,
                                 nsIRequest* aNewRequest,
-                                nsIDocument* aNewDocument)
+                                nsIDocument* aNewDocument,
+                                SavePresentationResult* aResult)
 {
+  SavePresentationResult unused;
+  SavePresentationResult& result = aResult ? *aResult : unused;
+
   if (!mOSHE) {
+    result = SavePresentationResult::NoEntry;
     return false;  // no entry to save into
   }
 
@@ -8260,6 +8308,7 @@ nsDocShell::CanSavePresentation(uint32_t aLoadType,
   mOSHE->GetContentViewer(getter_AddRefs(viewer));
   if (viewer) {
     NS_WARNING("mOSHE already has a content viewer!");
+    result = SavePresentationResult::HasViewer;
     return false;
   }
 
@@ -8272,6 +8321,7 @@ nsDocShell::CanSavePresentation(uint32_t aLoadType,
       aLoadType != LOAD_STOP_CONTENT &&
       aLoadType != LOAD_STOP_CONTENT_AND_REPLACE &&
       aLoadType != LOAD_ERROR_PAGE) {
+    result = SavePresentationResult::LoadType;
     return false;
   }
 
@@ -8280,21 +8330,25 @@ nsDocShell::CanSavePresentation(uint32_t aLoadType,
   bool canSaveState;
   mOSHE->GetSaveLayoutStateFlag(&canSaveState);
   if (!canSaveState) {
+    result = SavePresentationResult::NoLayoutState;
     return false;
   }
 
   // If the document is not done loading, don't cache it.
   if (!mScriptGlobal || mScriptGlobal->IsLoading()) {
+    result = SavePresentationResult::Loading;
     return false;
   }
 
   if (mScriptGlobal->WouldReuseInnerWindow(aNewDocument)) {
+    result = SavePresentationResult::ReusesInnerWindow;
     return false;
   }
 
   // Avoid doing the work of saving the presentation state in the case where
   // the content viewer cache is disabled.
   if (nsSHistory::GetMaxTotalViewers() == 0) {
+    result = SavePresentationResult::CacheDisabled;
     return false;
   }
 
@@ -8306,13 +8360,20 @@ nsDocShell::CanSavePresentation(uint32_t aLoadType,
     nsCOMPtr<nsIDocShellTreeItem> root;
     GetSameTypeParent(getter_AddRefs(root));
     if (root && root != this) {
+      result = SavePresentationResult::Subframe;
       return false;  // this is a subframe load
     }
   }
 
   // If the document does not want its presentation cached, then don't.
   nsCOMPtr<nsIDocument> doc = mScriptGlobal->GetExtantDoc();
-  return doc && doc->CanSavePresentation(aNewRequest);
+  if (!doc || !doc->CanSavePresentation(aNewRequest)) {
+    result = SavePresentationResult::DocumentRefused;
+    return false;
+  }
+
+  result = SavePresentationResult::Saved;
+  return true;
 }
 
 void
@@ -10702,7 +10763,10 @@ nsDocShell::InternalLoad(nsIURI* aURI,
   // new request parameter.
   // Also pass nullptr for the document, since it doesn't affect the return
   // value for our purposes here.
-  bool savePresentation = CanSavePresentation(aLoadType, nullptr, nullptr);
+  SavePresentationResult saveResult;
+  bool savePresentation = CanSavePresentation(aLoadType, nullptr, nullptr,
+                                              &saveResult);
+  AccumulateSavePresentationResult(saveResult);
 
   // Don't stop current network activity for javascript: URL's since
   // they might not result in any data, and thus nothing should be
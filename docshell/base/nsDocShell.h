@@ -714,10 +714,28 @@ protected:
   // presentation. |aNewRequest| should be the request for the document to
   // be loaded in place of the current document, or null if such a request
   // has not been created yet. |aNewDocument| should be the document that will
-  // replace the current document.
+  // replace the current document. If |aResult| is non-null it is set to the
+  // reason the presentation can't be saved, or to Saved.
+  enum class SavePresentationResult : uint8_t
+  {
+    NoEntry,
+    HasViewer,
+    LoadType,
+    NoLayoutState,
+    Loading,
+    ReusesInnerWindow,
+    CacheDisabled,
+    Subframe,
+    DocumentRefused,
+    Saved
+  };
   bool CanSavePresentation(uint32_t aLoadType,
                            nsIRequest* aNewRequest,
-                           nsIDocument* aNewDocument);
+                           nsIDocument* aNewDocument,
+                           SavePresentationResult* aResult = nullptr);
+
+  // Records a CanSavePresentation result in telemetry.
+  static void AccumulateSavePresentationResult(SavePresentationResult aResult);
 
   // Captures the state of the supporting elements of the presentation
   // (the "window" object, docshell tree, meta-refresh loads, and security
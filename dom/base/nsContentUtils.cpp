@@ -5356,6 +5356,20 @@ AppendNodeTextContentsRecurse(nsINode* aNode, nsAString& aResult,
   return true;
 }
 
+static void
+AddNodeTextContentLength(nsINode* aNode, bool aDeep, CheckedUint32& aLength)
+{
+  for (nsIContent* child = aNode->GetFirstChild();
+       child;
+       child = child->GetNextSibling()) {
+    if (aDeep && child->IsElement()) {
+      AddNodeTextContentLength(child, aDeep, aLength);
+    } else if (child->IsNodeOfType(nsINode::eTEXT)) {
+      aLength += child->TextLength();
+    }
+  }
+}
+
 /* static */
 bool
 nsContentUtils::AppendNodeTextContent(nsINode* aNode, bool aDeep,
@@ -5366,6 +5380,19 @@ nsContentUtils::AppendNodeTextContent(nsINode* aNode, bool aDeep,
     return static_cast<nsIContent*>(aNode)->AppendTextTo(aResult,
                                                          aFallible);
   }
+
+  // Reserve the final length up front so that appending many text nodes
+  // doesn't repeatedly reallocate the buffer.
+  CheckedUint32 length = aResult.Length();
+  AddNodeTextContentLength(aNode, aDeep, length);
+  if (!length.isValid()) {
+    return false;
+  }
+  if (length.value() > aResult.Length() &&
+      !aResult.SetCapacity(length.value(), aFallible)) {
+    return false;
+  }
+
   if (aDeep) {
     return AppendNodeTextContentsRecurse(aNode, aResult, aFallible);
   }
@@ -9211,7 +9238,7 @@ nsContentUtils::InternalStorageAllowedForPrincipal(nsIPrincipal* aPrincipal,
   if (aWindow && (behavior == nsICookieService::BEHAVIOR_REJECT_FOREIGN ||
                   behavior == nsICookieService::BEHAVIOR_LIMIT_FOREIGN)) {
     nsCOMPtr<mozIThirdPartyUtil> thirdPartyUtil =
-      do_GetService(THIRDPARTYUTIL_CONTRACTID);
+      services::GetThirdPartyUtil();
     MOZ_ASSERT(thirdPartyUtil);
 
     bool thirdPartyWindow = false;
@@ -9368,38 +9395,47 @@ public:
 
   bool ToString(nsAString& aOut)
   {
-    if (!aOut.SetCapacity(mLength, fallible)) {
+    // mLength is exact (the encoding units were sized when they were
+    // appended), so allocate once and write the units straight into the
+    // buffer instead of going through the capacity checks of Append.
+    if (!aOut.SetLength(mLength, fallible)) {
       return false;
     }
 
+    char16_t* out = aOut.BeginWriting();
     for (StringBuilder* current = this; current; current = current->mNext) {
       uint32_t len = current->mUnits.Length();
       for (uint32_t i = 0; i < len; ++i) {
         Unit& u = current->mUnits[i];
         switch (u.mType) {
           case Unit::eAtom:
-            aOut.Append(nsDependentAtomString(u.mAtom));
+            out = Copy(u.mAtom->GetUTF16String(), u.mLength, out);
             break;
           case Unit::eString:
-            aOut.Append(*(u.mString));
+            out = Copy(u.mString->BeginReading(), u.mLength, out);
             break;
           case Unit::eStringWithEncode:
-            EncodeAttrString(*(u.mString), aOut);
+            out = EncodeAttrString(*(u.mString), out);
             break;
           case Unit::eLiteral:
-            aOut.AppendASCII(u.mLiteral, u.mLength);
+            out = Copy(u.mLiteral, u.mLength, out);
             break;
           case Unit::eTextFragment:
-            u.mTextFragment->AppendTo(aOut);
+            if (u.mTextFragment->Is2b()) {
+              out = Copy(u.mTextFragment->Get2b(), u.mLength, out);
+            } else {
+              out = Copy(u.mTextFragment->Get1b(), u.mLength, out);
+            }
             break;
           case Unit::eTextFragmentWithEncode:
-            EncodeTextFragment(u.mTextFragment, aOut);
+            out = EncodeTextFragment(u.mTextFragment, out);
             break;
           default:
             MOZ_CRASH("Unknown unit type?");
         }
       }
     }
+    MOZ_ASSERT(out == aOut.EndReading(), "Miscounted serialization length");
     return true;
   }
 private:
@@ -9419,77 +9455,85 @@ private:
     aFirst->mLast = this;
   }
 
-  void EncodeAttrString(const nsAutoString& aValue, nsAString& aOut)
+  static char16_t* Copy(const char16_t* aSrc, uint32_t aLen, char16_t* aOut)
+  {
+    memcpy(aOut, aSrc, aLen * sizeof(char16_t));
+    return aOut + aLen;
+  }
+
+  static char16_t* Copy(const char* aSrc, uint32_t aLen, char16_t* aOut)
+  {
+    for (uint32_t i = 0; i < aLen; ++i) {
+      *aOut++ = static_cast<unsigned char>(aSrc[i]);
+    }
+    return aOut;
+  }
+
+  template<int N>
+  static char16_t* CopyLiteral(const char (&aLiteral)[N], char16_t* aOut)
+  {
+    return Copy(aLiteral, N - 1, aOut);
+  }
+
+  static char16_t* EncodeAttrString(const nsAutoString& aValue, char16_t* aOut)
   {
     const char16_t* c = aValue.BeginReading();
     const char16_t* end = aValue.EndReading();
     while (c < end) {
       switch (*c) {
       case '"':
-        aOut.AppendLiteral("&quot;");
+        aOut = CopyLiteral("&quot;", aOut);
         break;
       case '&':
-        aOut.AppendLiteral("&amp;");
+        aOut = CopyLiteral("&amp;", aOut);
         break;
       case 0x00A0:
-        aOut.AppendLiteral("&nbsp;");
+        aOut = CopyLiteral("&nbsp;", aOut);
         break;
       default:
-        aOut.Append(*c);
+        *aOut++ = *c;
         break;
       }
       ++c;
     }
+    return aOut;
+  }
+
+  template<typename CharT, typename UnsignedCharT>
+  static char16_t* EncodeText(const CharT* aData, uint32_t aLen,
+                              char16_t* aOut)
+  {
+    for (uint32_t i = 0; i < aLen; ++i) {
+      const UnsignedCharT c = aData[i];
+      switch (c) {
+        case '<':
+          aOut = CopyLiteral("&lt;", aOut);
+          break;
+        case '>':
+          aOut = CopyLiteral("&gt;", aOut);
+          break;
+        case '&':
+          aOut = CopyLiteral("&amp;", aOut);
+          break;
+        case 0x00A0:
+          aOut = CopyLiteral("&nbsp;", aOut);
+          break;
+        default:
+          *aOut++ = c;
+          break;
+      }
+    }
+    return aOut;
   }
 
-  void EncodeTextFragment(const nsTextFragment* aValue, nsAString& aOut)
+  static char16_t* EncodeTextFragment(const nsTextFragment* aValue,
+                                      char16_t* aOut)
   {
     uint32_t len = aValue->GetLength();
     if (aValue->Is2b()) {
-      const char16_t* data = aValue->Get2b();
-      for (uint32_t i = 0; i < len; ++i) {
-        const char16_t c = data[i];
-        switch (c) {
-          case '<':
-            aOut.AppendLiteral("&lt;");
-            break;
-          case '>':
-            aOut.AppendLiteral("&gt;");
-            break;
-          case '&':
-            aOut.AppendLiteral("&amp;");
-            break;
-          case 0x00A0:
-            aOut.AppendLiteral("&nbsp;");
-            break;
-          default:
-            aOut.Append(c);
-            break;
-        }
-      }
-    } else {
-      const char* data = aValue->Get1b();
-      for (uint32_t i = 0; i < len; ++i) {
-        const unsigned char c = data[i];
-        switch (c) {
-          case '<':
-            aOut.AppendLiteral("&lt;");
-            break;
-          case '>':
-            aOut.AppendLiteral("&gt;");
-            break;
-          case '&':
-            aOut.AppendLiteral("&amp;");
-            break;
-          case 0x00A0:
-            aOut.AppendLiteral("&nbsp;");
-            break;
-          default:
-            aOut.Append(c);
-            break;
-        }
-      }
+      return EncodeText<char16_t, char16_t>(aValue->Get2b(), len, aOut);
     }
+    return EncodeText<char, unsigned char>(aValue->Get1b(), len, aOut);
   }
 
   AutoTArray<Unit, STRING_BUFFER_UNITS> mUnits;
@@ -2705,6 +2705,14 @@ nsJSContext::EnsureStatics()
                                        "javascript.options.mem.gc_max_empty_chunk_count",
                                        (void *)JSGC_MAX_EMPTY_CHUNK_COUNT);
 
+  Preferences::RegisterCallbackAndCall(SetMemoryPrefChangedCallbackInt,
+                                       "javascript.options.mem.gc_min_free_committed_arenas",
+                                       (void *)JSGC_MIN_FREE_COMMITTED_ARENAS);
+
+  Preferences::RegisterCallbackAndCall(SetMemoryPrefChangedCallbackBool,
+                                       "javascript.options.mem.gc_high_frequency_decommit",
+                                       (void *)JSGC_HIGH_FREQUENCY_DECOMMIT_ENABLED);
+
   nsCOMPtr<nsIObserverService> obs = mozilla::services::GetObserverService();
   if (!obs) {
     MOZ_CRASH();
@@ -364,6 +364,13 @@ CollectWindowReports(nsGlobalWindow *aWindow,
               "within a window.");
   aWindowTotalSizes->mLayoutPresShellSize += windowSizes.mLayoutPresShellSize;
 
+  REPORT_SIZE("/layout/arena-free-lists", windowSizes.mLayoutArenaFreeListsSize,
+              "Memory held in the PresShell's arena for frames and other "
+              "arena-allocated objects that have been destroyed and are "
+              "waiting on free lists for reuse, within a window.");
+  aWindowTotalSizes->mLayoutArenaFreeListsSize +=
+    windowSizes.mLayoutArenaFreeListsSize;
+
   REPORT_SIZE("/layout/style-sets", windowSizes.mLayoutStyleSetsSize,
               "Memory used by style sets within a window.");
   aWindowTotalSizes->mLayoutStyleSetsSize += windowSizes.mLayoutStyleSetsSize;
@@ -638,6 +645,10 @@ nsWindowMemoryReporter::CollectReports(nsIHandleReportCallback* aHandleReport,
          windowTotalSizes.mLayoutPresShellSize,
          "This is the sum of all windows' 'layout/arenas' numbers.");
 
+  REPORT("window-objects/layout/arena-free-lists",
+         windowTotalSizes.mLayoutArenaFreeListsSize,
+         "This is the sum of all windows' 'layout/arena-free-lists' numbers.");
+
   REPORT("window-objects/layout/style-sets",
          windowTotalSizes.mLayoutStyleSetsSize,
          "This is the sum of all windows' 'layout/style-sets' numbers.");
@@ -376,9 +376,13 @@ WebGLContext::GetParameter(JSContext* cx, GLenum pname, ErrorResult& rv)
             return JS::Int32Value(refValue & stencilMask);
         }
 
-        case LOCAL_GL_STENCIL_CLEAR_VALUE:
         case LOCAL_GL_UNPACK_ALIGNMENT:
+            return JS::Int32Value(mPixelStore_UnpackAlignment);
+
         case LOCAL_GL_PACK_ALIGNMENT:
+            return JS::Int32Value(mPixelStore_PackAlignment);
+
+        case LOCAL_GL_STENCIL_CLEAR_VALUE:
         case LOCAL_GL_SUBPIXEL_BITS:
         case LOCAL_GL_SAMPLE_BUFFERS:
         case LOCAL_GL_SAMPLES: {
@@ -460,6 +464,8 @@ WebGLContext::GetParameter(JSContext* cx, GLenum pname, ErrorResult& rv)
             return JS::DoubleValue(mLineWidth);
 
         case LOCAL_GL_DEPTH_CLEAR_VALUE:
+            return JS::DoubleValue(mDepthClearValue);
+
         case LOCAL_GL_POLYGON_OFFSET_FACTOR:
         case LOCAL_GL_POLYGON_OFFSET_UNITS:
         case LOCAL_GL_SAMPLE_COVERAGE_VALUE: {
@@ -478,13 +484,19 @@ WebGLContext::GetParameter(JSContext* cx, GLenum pname, ErrorResult& rv)
         case LOCAL_GL_SCISSOR_TEST:
         case LOCAL_GL_SAMPLE_COVERAGE_INVERT:
         case LOCAL_GL_SAMPLE_ALPHA_TO_COVERAGE:
-        case LOCAL_GL_SAMPLE_COVERAGE:
-        case LOCAL_GL_DEPTH_WRITEMASK: {
+        case LOCAL_GL_SAMPLE_COVERAGE: {
+            // Caps we track ourselves don't need a round trip to the driver.
+            if (const auto trackingSlot = GetStateTrackingSlot(pname))
+                return JS::BooleanValue(bool(*trackingSlot));
+
             realGLboolean b = 0;
             gl->fGetBooleanv(pname, &b);
             return JS::BooleanValue(bool(b));
         }
 
+        case LOCAL_GL_DEPTH_WRITEMASK:
+            return JS::BooleanValue(bool(mDepthWriteMask));
+
         // bool, WebGL-specific
         case UNPACK_FLIP_Y_WEBGL:
             return JS::BooleanValue(mPixelStore_FlipY);
@@ -528,7 +540,13 @@ WebGLContext::GetParameter(JSContext* cx, GLenum pname, ErrorResult& rv)
         case LOCAL_GL_COLOR_CLEAR_VALUE:
         case LOCAL_GL_BLEND_COLOR: {
             GLfloat fv[4] = { 0 };
-            gl->fGetFloatv(pname, fv);
+            if (pname == LOCAL_GL_COLOR_CLEAR_VALUE) {
+                for (size_t i = 0; i < 4; i++) {
+                    fv[i] = mColorClearValue[i];
+                }
+            } else {
+                gl->fGetFloatv(pname, fv);
+            }
             JSObject* obj = dom::Float32Array::Create(cx, this, 4, fv);
             if (!obj) {
                 rv = NS_ERROR_OUT_OF_MEMORY;
@@ -550,7 +568,14 @@ WebGLContext::GetParameter(JSContext* cx, GLenum pname, ErrorResult& rv)
         case LOCAL_GL_SCISSOR_BOX:
         case LOCAL_GL_VIEWPORT: {
             GLint iv[4] = { 0 };
-            gl->fGetIntegerv(pname, iv);
+            if (pname == LOCAL_GL_VIEWPORT) {
+                iv[0] = mViewportX;
+                iv[1] = mViewportY;
+                iv[2] = mViewportWidth;
+                iv[3] = mViewportHeight;
+            } else {
+                gl->fGetIntegerv(pname, iv);
+            }
             JSObject* obj = dom::Int32Array::Create(cx, this, 4, iv);
             if (!obj) {
                 rv = NS_ERROR_OUT_OF_MEMORY;
@@ -560,10 +585,8 @@ WebGLContext::GetParameter(JSContext* cx, GLenum pname, ErrorResult& rv)
 
         // 4 bools
         case LOCAL_GL_COLOR_WRITEMASK: {
-            realGLboolean gl_bv[4] = { 0 };
-            gl->fGetBooleanv(pname, gl_bv);
-            bool vals[4] = { bool(gl_bv[0]), bool(gl_bv[1]),
-                             bool(gl_bv[2]), bool(gl_bv[3]) };
+            bool vals[4] = { bool(mColorWriteMask[0]), bool(mColorWriteMask[1]),
+                             bool(mColorWriteMask[2]), bool(mColorWriteMask[3]) };
             JS::Rooted<JS::Value> arr(cx);
             if (!dom::ToJSValue(cx, vals, &arr)) {
                 rv = NS_ERROR_OUT_OF_MEMORY;
@@ -648,6 +671,9 @@ WebGLContext::IsEnabled(GLenum cap)
     if (!ValidateCapabilityEnum(cap, "isEnabled"))
         return false;
 
+    if (const auto trackingSlot = GetStateTrackingSlot(cap))
+        return bool(*trackingSlot);
+
     MakeContextCurrent();
     return gl->fIsEnabled(cap);
 }
@@ -137,6 +137,7 @@ EventListenerManagerBase::EventListenerManagerBase()
 EventListenerManager::EventListenerManager(EventTarget* aTarget)
   : EventListenerManagerBase()
   , mTarget(aTarget)
+  , mNoListenerForPreviousEvent(eVoidEvent)
 {
   NS_ASSERTION(aTarget, "unexpected null pointer");
 
@@ -276,6 +277,7 @@ EventListenerManager::AddEventListenerInternal(
 
   mNoListenerForEvent = eVoidEvent;
   mNoListenerForEventAtom = nullptr;
+  mNoListenerForPreviousEvent = eVoidEvent;
 
   listener = aAllEvents ? mListeners.InsertElementAt(0) :
                           mListeners.AppendElement();
@@ -593,6 +595,7 @@ EventListenerManager::NotifyEventListenerRemoved(nsIAtom* aUserType,
   // and NotifyAboutMainThreadListenerChange should be changed too.
   mNoListenerForEvent = eVoidEvent;
   mNoListenerForEventAtom = nullptr;
+  mNoListenerForPreviousEvent = eVoidEvent;
   if (mTarget) {
     if (aUserType) {
       mTarget->EventListenerRemoved(aUserType);
@@ -1352,6 +1355,10 @@ EventListenerManager::HandleEventInternal(nsPresContext* aPresContext,
   }
 
   if (mIsMainThreadELM && !hasListener) {
+    if (mNoListenerForEvent != aEvent->mMessage &&
+        mNoListenerForEvent != eUnidentifiedEvent) {
+      mNoListenerForPreviousEvent = mNoListenerForEvent;
+    }
     mNoListenerForEvent = aEvent->mMessage;
     mNoListenerForEventAtom = aEvent->mSpecifiedEventType;
   }
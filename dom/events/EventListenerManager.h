@@ -372,6 +372,9 @@ public:
          mNoListenerForEventAtom == aEvent->mSpecifiedEventType)) {
       return;
     }
+    if (mNoListenerForPreviousEvent == aEvent->mMessage) {
+      return;
+    }
     HandleEventInternal(aPresContext, aEvent, aDOMEvent, aCurrentTarget,
                         aEventStatus);
   }
@@ -632,6 +635,10 @@ protected:
   nsAutoTObserverArray<Listener, 2> mListeners;
   dom::EventTarget* MOZ_NON_OWNING_REF mTarget;
   nsCOMPtr<nsIAtom> mNoListenerForEventAtom;
+  // The event mNoListenerForEvent held before it was last updated, so that
+  // events which are dispatched in pairs (e.g. pointermove and mousemove)
+  // don't keep evicting each other. Never eUnidentifiedEvent.
+  EventMessage mNoListenerForPreviousEvent;
 
   friend class ELMCreationDetector;
   static uint32_t sMainThreadCreatedCount;
@@ -33,6 +33,8 @@
 #include "mozilla/SnappyUncompressInputStream.h"
 #include "mozilla/StaticPtr.h"
 #include "mozilla/storage.h"
+#include "mozilla/Telemetry.h"
+#include "mozilla/TimeStamp.h"
 #include "mozilla/Unused.h"
 #include "mozilla/UniquePtrExtensions.h"
 #include "mozilla/dom/ContentParent.h"
@@ -5784,6 +5786,7 @@ public:
   const nsTArray<nsString> mObjectStoreNames;
   nsTHashtable<nsPtrHashKey<TransactionInfo>> mBlockedOn;
   nsTArray<nsCOMPtr<nsIRunnable>> mQueuedRunnables;
+  const TimeStamp mCreationTime;
   const bool mIsWriteTransaction;
   bool mRunning;
 
@@ -12653,6 +12656,16 @@ ConnectionPool::ScheduleTransaction(TransactionInfo* aTransactionInfo,
   MOZ_ASSERT(!aTransactionInfo->mRunning);
   aTransactionInfo->mRunning = true;
 
+  // Record how long this transaction waited, whether behind conflicting
+  // transactions, for a connection thread, or for the database's single
+  // write slot.
+  Telemetry::Accumulate(
+    Telemetry::IDB_TRANSACTION_SCHEDULING_DELAY_MS,
+    aTransactionInfo->mIsWriteTransaction ? NS_LITERAL_CSTRING("readwrite")
+                                          : NS_LITERAL_CSTRING("readonly"),
+    static_cast<uint32_t>(
+      (TimeStamp::Now() - aTransactionInfo->mCreationTime).ToMilliseconds()));
+
   nsTArray<nsCOMPtr<nsIRunnable>>& queuedRunnables =
     aTransactionInfo->mQueuedRunnables;
 
@@ -13444,6 +13457,7 @@ TransactionInfo::TransactionInfo(
   , mTransactionId(aTransactionId)
   , mLoggingSerialNumber(aLoggingSerialNumber)
   , mObjectStoreNames(aObjectStoreNames)
+  , mCreationTime(TimeStamp::Now())
   , mIsWriteTransaction(aIsWriteTransaction)
   , mRunning(false)
 #ifdef DEBUG
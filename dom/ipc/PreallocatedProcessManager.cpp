@@ -19,6 +19,10 @@
 // loading its content, to reduce CPU/memory/IO contention.
 #define DEFAULT_ALLOCATE_DELAY 1000
 
+// Number of preallocated processes kept around by default; see
+// dom.ipc.processPrelaunch.count.
+#define DEFAULT_PREALLOCATED_PROCESS_COUNT 1
+
 using namespace mozilla;
 using namespace mozilla::hal;
 using namespace mozilla::dom;
@@ -67,7 +71,10 @@ private:
 
   bool mEnabled;
   bool mShutdown;
-  RefPtr<ContentParent> mPreallocatedProcess;
+  // How many processes we try to keep in mPreallocatedProcesses.
+  uint32_t mPoolSize;
+  // Launched in order, so the first one is the likeliest to be ready.
+  nsTArray<RefPtr<ContentParent>> mPreallocatedProcesses;
   nsTHashtable<nsUint64HashKey> mBlockers;
 };
 
@@ -92,12 +99,14 @@ NS_IMPL_ISUPPORTS(PreallocatedProcessManagerImpl, nsIObserver)
 PreallocatedProcessManagerImpl::PreallocatedProcessManagerImpl()
   : mEnabled(false)
   , mShutdown(false)
+  , mPoolSize(DEFAULT_PREALLOCATED_PROCESS_COUNT)
 {}
 
 void
 PreallocatedProcessManagerImpl::Init()
 {
   Preferences::AddStrongObserver(this, "dom.ipc.processPrelaunch.enabled");
+  Preferences::AddStrongObserver(this, "dom.ipc.processPrelaunch.count");
   // We have to respect processCount at all time. This is especially important
   // for testing.
   Preferences::AddStrongObserver(this, "dom.ipc.processCount");
@@ -126,6 +135,7 @@ PreallocatedProcessManagerImpl::Observe(nsISupports* aSubject,
   } else if (!strcmp(NS_XPCOM_SHUTDOWN_OBSERVER_ID, aTopic) ||
              !strcmp("profile-change-teardown", aTopic)) {
     Preferences::RemoveObserver(this, "dom.ipc.processPrelaunch.enabled");
+    Preferences::RemoveObserver(this, "dom.ipc.processPrelaunch.count");
     Preferences::RemoveObserver(this, "dom.ipc.processCount");
     nsCOMPtr<nsIObserverService> os = services::GetObserverService();
     if (os) {
@@ -134,8 +144,8 @@ PreallocatedProcessManagerImpl::Observe(nsISupports* aSubject,
       os->RemoveObserver(this, "profile-change-teardown");
     }
     // Let's prevent any new preallocated processes from starting. ContentParent will
-    // handle the shutdown of the existing process and the mPreallocatedProcess reference
-    // will be cleared by the ClearOnShutdown of the manager singleton.
+    // handle the shutdown of the existing processes and the mPreallocatedProcesses
+    // references will be cleared by the ClearOnShutdown of the manager singleton.
     mShutdown = true;
   } else {
     MOZ_ASSERT(false);
@@ -147,6 +157,13 @@ PreallocatedProcessManagerImpl::Observe(nsISupports* aSubject,
 void
 PreallocatedProcessManagerImpl::RereadPrefs()
 {
+  mPoolSize = Preferences::GetUint("dom.ipc.processPrelaunch.count",
+                                   DEFAULT_PREALLOCATED_PROCESS_COUNT);
+  if (!mPoolSize) {
+    mPoolSize = 1;
+  }
+
+  bool wasEnabled = mEnabled;
   if (mozilla::BrowserTabsRemoteAutostart() &&
       Preferences::GetBool("dom.ipc.processPrelaunch.enabled")) {
     Enable();
@@ -156,6 +173,19 @@ PreallocatedProcessManagerImpl::RereadPrefs()
 
   if (ContentParent::IsMaxProcessCountReached(NS_LITERAL_STRING(DEFAULT_REMOTE_TYPE))) {
     CloseProcess();
+    return;
+  }
+
+  // Shut down the newest processes if the pool was made smaller, or top it
+  // up if it was made larger.
+  while (mPreallocatedProcesses.Length() > mPoolSize) {
+    RefPtr<ContentParent> process = mPreallocatedProcesses.LastElement();
+    mPreallocatedProcesses.RemoveElementAt(mPreallocatedProcesses.Length() - 1);
+    process->ShutDownProcess(ContentParent::SEND_SHUTDOWN_MESSAGE);
+  }
+  // Enable() has already scheduled an allocation if we just got enabled.
+  if (wasEnabled && mEnabled && mPreallocatedProcesses.Length() < mPoolSize) {
+    AllocateAfterDelay();
   }
 }
 
@@ -166,25 +196,35 @@ PreallocatedProcessManagerImpl::Take()
     return nullptr;
   }
 
-  if (mPreallocatedProcess) {
-    // The preallocated process is taken. Let's try to start up a new one soon.
-    AllocateOnIdle();
+  if (mPreallocatedProcesses.IsEmpty()) {
+    return nullptr;
   }
 
-  return mPreallocatedProcess.forget();
+  RefPtr<ContentParent> process = mPreallocatedProcesses[0];
+  mPreallocatedProcesses.RemoveElementAt(0);
+
+  // A preallocated process is taken. Let's try to start up a new one soon.
+  AllocateOnIdle();
+
+  return process.forget();
 }
 
 bool
 PreallocatedProcessManagerImpl::Provide(ContentParent* aParent)
 {
-  if (mEnabled && !mShutdown && !mPreallocatedProcess) {
-    mPreallocatedProcess = aParent;
-  }
-
   // We might get a call from both NotifyTabDestroying and NotifyTabDestroyed with the same
   // ContentParent. Returning true here for both calls is important to avoid the cached process
   // to be destroyed.
-  return aParent == mPreallocatedProcess;
+  if (mPreallocatedProcesses.Contains(aParent)) {
+    return true;
+  }
+
+  if (mEnabled && !mShutdown && mPreallocatedProcesses.Length() < mPoolSize) {
+    mPreallocatedProcesses.AppendElement(aParent);
+    return true;
+  }
+
+  return false;
 }
 
 void
@@ -212,7 +252,7 @@ PreallocatedProcessManagerImpl::RemoveBlocker(ContentParent* aParent)
   uint64_t childID = aParent->ChildID();
   MOZ_ASSERT(mBlockers.Contains(childID));
   mBlockers.RemoveEntry(childID);
-  if (!mPreallocatedProcess && mBlockers.IsEmpty()) {
+  if (mPreallocatedProcesses.Length() < mPoolSize && mBlockers.IsEmpty()) {
     AllocateAfterDelay();
   }
 }
@@ -222,7 +262,7 @@ PreallocatedProcessManagerImpl::CanAllocate()
 {
   return mEnabled &&
          mBlockers.IsEmpty() &&
-         !mPreallocatedProcess &&
+         mPreallocatedProcesses.Length() < mPoolSize &&
          !mShutdown &&
          !ContentParent::IsMaxProcessCountReached(NS_LITERAL_STRING(DEFAULT_REMOTE_TYPE));
 }
@@ -259,14 +299,21 @@ void
 PreallocatedProcessManagerImpl::AllocateNow()
 {
   if (!CanAllocate()) {
-    if (mEnabled && !mShutdown && !mPreallocatedProcess && !mBlockers.IsEmpty()) {
+    if (mEnabled && !mShutdown && mPreallocatedProcesses.Length() < mPoolSize &&
+        !mBlockers.IsEmpty()) {
       // If it's too early to allocate a process let's retry later.
       AllocateAfterDelay();
     }
     return;
   }
 
-  mPreallocatedProcess = ContentParent::PreallocateProcess();
+  // The new process blocks further allocations until it has finished
+  // starting up, so the pool is filled one process at a time and each
+  // RemoveBlocker schedules the next launch.
+  RefPtr<ContentParent> process = ContentParent::PreallocateProcess();
+  if (process) {
+    mPreallocatedProcesses.AppendElement(process);
+  }
 }
 
 void
@@ -283,9 +330,10 @@ PreallocatedProcessManagerImpl::Disable()
 void
 PreallocatedProcessManagerImpl::CloseProcess()
 {
-  if (mPreallocatedProcess) {
-    mPreallocatedProcess->ShutDownProcess(ContentParent::SEND_SHUTDOWN_MESSAGE);
-    mPreallocatedProcess = nullptr;
+  nsTArray<RefPtr<ContentParent>> processes;
+  processes.SwapElements(mPreallocatedProcesses);
+  for (auto& process : processes) {
+    process->ShutDownProcess(ContentParent::SEND_SHUTDOWN_MESSAGE);
   }
 }
 
@@ -299,8 +347,11 @@ PreallocatedProcessManagerImpl::ObserveProcessShutdown(nsISupports* aSubject)
   props->GetPropertyAsUint64(NS_LITERAL_STRING("childID"), &childID);
   NS_ENSURE_TRUE_VOID(childID != CONTENT_PROCESS_ID_UNKNOWN);
 
-  if (mPreallocatedProcess && childID == mPreallocatedProcess->ChildID()) {
-    mPreallocatedProcess = nullptr;
+  for (uint32_t i = 0; i < mPreallocatedProcesses.Length(); ++i) {
+    if (mPreallocatedProcesses[i]->ChildID() == childID) {
+      mPreallocatedProcesses.RemoveElementAt(i);
+      break;
+    }
   }
 
   mBlockers.RemoveEntry(childID);
@@ -13,7 +13,6 @@
 #include "MemoryBlockCache.h"
 #include "mozilla/Attributes.h"
 #include "mozilla/Logging.h"
-#include "mozilla/Preferences.h"
 #include "mozilla/ReentrantMonitor.h"
 #include "mozilla/Services.h"
 #include "mozilla/StaticPtr.h"
@@ -1244,8 +1243,8 @@ MediaCache::Update()
       }
     }
 
-    int32_t resumeThreshold = Preferences::GetInt("media.cache_resume_threshold", 10);
-    int32_t readaheadLimit = Preferences::GetInt("media.cache_readahead_limit", 30);
+    int32_t resumeThreshold = int32_t(MediaPrefs::MediaCacheResumeThreshold());
+    int32_t readaheadLimit = int32_t(MediaPrefs::MediaCacheReadaheadLimit());
 
     for (uint32_t i = 0; i < mStreams.Length(); ++i) {
       actions.AppendElement(NONE);
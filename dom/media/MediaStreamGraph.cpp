@@ -1221,6 +1221,16 @@ MediaStreamGraphImpl::ProduceDataForStreamsBlockByBlock(uint32_t aStreamIndex,
 {
   MOZ_ASSERT(aStreamIndex <= mFirstCycleBreaker,
              "Cycle breaker is not AudioNodeStream?");
+  // The set of processed streams doesn't change while we produce blocks, so
+  // look them up once rather than once per block.
+  AutoTArray<ProcessedMediaStream*, 64> processedStreams;
+  for (uint32_t i = aStreamIndex; i < mStreams.Length(); ++i) {
+    ProcessedMediaStream* ps = mStreams[i]->AsProcessedStream();
+    if (ps) {
+      processedStreams.AppendElement(ps);
+    }
+  }
+
   GraphTime t = mProcessedTime;
   while (t < mStateComputedTime) {
     GraphTime next = RoundUpToNextAudioBlock(t);
@@ -1229,12 +1239,10 @@ MediaStreamGraphImpl::ProduceDataForStreamsBlockByBlock(uint32_t aStreamIndex,
       MOZ_ASSERT(ns->AsAudioNodeStream());
       ns->ProduceOutputBeforeInput(t);
     }
-    for (uint32_t i = aStreamIndex; i < mStreams.Length(); ++i) {
-      ProcessedMediaStream* ps = mStreams[i]->AsProcessedStream();
-      if (ps) {
-        ps->ProcessInput(t, next,
-            (next == mStateComputedTime) ? ProcessedMediaStream::ALLOW_FINISH : 0);
-      }
+    uint32_t flags =
+      (next == mStateComputedTime) ? ProcessedMediaStream::ALLOW_FINISH : 0;
+    for (ProcessedMediaStream* ps : processedStreams) {
+      ps->ProcessInput(t, next, flags);
     }
     t = next;
   }
@@ -1865,7 +1865,7 @@ TrackBuffersManager::RemoveFrames(const TimeIntervals& aIntervals,
   TimeUnit intervalsEnd = aIntervals.GetEnd();
   bool mayBreakLoop = false;
   for (uint32_t i = aStartIndex; i < data.Length(); i++) {
-    const RefPtr<MediaRawData> sample = data[i];
+    const RefPtr<MediaRawData>& sample = data[i];
     TimeInterval sampleInterval =
       TimeInterval(sample->mTime, sample->GetEndTime());
     if (aIntervals.Contains(sampleInterval)) {
@@ -1902,7 +1902,7 @@ TrackBuffersManager::RemoveFrames(const TimeIntervals& aIntervals,
   uint32_t sizeRemoved = 0;
   TimeIntervals removedIntervals;
   for (uint32_t i = firstRemovedIndex.ref(); i <= lastRemovedIndex; i++) {
-    const RefPtr<MediaRawData> sample = data[i];
+    const RefPtr<MediaRawData>& sample = data[i];
     TimeInterval sampleInterval =
       TimeInterval(sample->mTime, sample->GetEndTime());
     removedIntervals += sampleInterval;
@@ -213,6 +213,57 @@ AudioBlockPanStereoToStereo_SSE(const float aInputL[WEBAUDIO_BLOCK_SIZE],
   }
 }
 
+void
+AudioBlockPanStereoToStereo_SSE(const float aInputL[WEBAUDIO_BLOCK_SIZE],
+                                const float aInputR[WEBAUDIO_BLOCK_SIZE],
+                                float aGainL[WEBAUDIO_BLOCK_SIZE],
+                                float aGainR[WEBAUDIO_BLOCK_SIZE],
+                                bool aIsOnTheLeft[WEBAUDIO_BLOCK_SIZE],
+                                float aOutputL[WEBAUDIO_BLOCK_SIZE],
+                                float aOutputR[WEBAUDIO_BLOCK_SIZE])
+{
+  __m128 vinl, vinr, vgainl, vgainr, vonleft,
+         voutlleft, voutlright, voutrleft, voutrright;
+  __m128i vzero = _mm_setzero_si128();
+
+  ASSERT_ALIGNED16(aInputL);
+  ASSERT_ALIGNED16(aInputR);
+  ASSERT_ALIGNED16(aGainL);
+  ASSERT_ALIGNED16(aGainR);
+  ASSERT_ALIGNED16(aOutputL);
+  ASSERT_ALIGNED16(aOutputR);
+
+  for (unsigned i = 0; i < WEBAUDIO_BLOCK_SIZE; i+=4) {
+    vinl = _mm_load_ps(&aInputL[i]);
+    vinr = _mm_load_ps(&aInputR[i]);
+    vgainl = _mm_load_ps(&aGainL[i]);
+    vgainr = _mm_load_ps(&aGainR[i]);
+
+    /* all ones in the lanes where the source is on the left */
+    vonleft = _mm_castsi128_ps(
+      _mm_cmpgt_epi32(_mm_set_epi32(aIsOnTheLeft[i + 3], aIsOnTheLeft[i + 2],
+                                    aIsOnTheLeft[i + 1], aIsOnTheLeft[i]),
+                      vzero));
+
+    /* on the left: aOutputL = aInputL + aInputR * gainL,
+     *              aOutputR = aInputR * gainR */
+    voutlleft = _mm_add_ps(vinl, _mm_mul_ps(vinr, vgainl));
+    voutrleft = _mm_mul_ps(vinr, vgainr);
+
+    /* on the right: aOutputL = aInputL * gainL,
+     *               aOutputR = aInputR + aInputL * gainR */
+    voutlright = _mm_mul_ps(vinl, vgainl);
+    voutrright = _mm_add_ps(vinr, _mm_mul_ps(vinl, vgainr));
+
+    _mm_store_ps(&aOutputL[i],
+                 _mm_or_ps(_mm_and_ps(vonleft, voutlleft),
+                           _mm_andnot_ps(vonleft, voutlright)));
+    _mm_store_ps(&aOutputR[i],
+                 _mm_or_ps(_mm_and_ps(vonleft, voutrleft),
+                           _mm_andnot_ps(vonleft, voutrright)));
+  }
+}
+
 void BufferComplexMultiply_SSE(const float* aInput,
                                const float* aScale,
                                float* aOutput,
@@ -34,6 +34,15 @@ AudioBlockPanStereoToStereo_SSE(const float aInputL[WEBAUDIO_BLOCK_SIZE],
                                 float aOutputL[WEBAUDIO_BLOCK_SIZE],
                                 float aOutputR[WEBAUDIO_BLOCK_SIZE]);
 
+void
+AudioBlockPanStereoToStereo_SSE(const float aInputL[WEBAUDIO_BLOCK_SIZE],
+                                const float aInputR[WEBAUDIO_BLOCK_SIZE],
+                                float aGainL[WEBAUDIO_BLOCK_SIZE],
+                                float aGainR[WEBAUDIO_BLOCK_SIZE],
+                                bool aIsOnTheLeft[WEBAUDIO_BLOCK_SIZE],
+                                float aOutputL[WEBAUDIO_BLOCK_SIZE],
+                                float aOutputR[WEBAUDIO_BLOCK_SIZE]);
+
 float
 AudioBufferSumOfSquares_SSE(const float* aInput, uint32_t aLength);
 
@@ -0,0 +1,50 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim:set ts=2 sw=2 sts=2 et cindent: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "AudioNodeEngine.h"
+#include "AlignmentUtils.h"
+#include "gtest/gtest.h"
+
+using namespace mozilla;
+
+// Whichever kernel AudioBlockPanStereoToStereo dispatches to must match the
+// scalar definition for per-sample gains.
+TEST(AudioNodeEngine, PanStereoToStereoPerSample)
+{
+  float storage[6 * WEBAUDIO_BLOCK_SIZE + 4];
+  float* inputL = ALIGNED16(storage);
+  float* inputR = inputL + WEBAUDIO_BLOCK_SIZE;
+  float* gainL = inputR + WEBAUDIO_BLOCK_SIZE;
+  float* gainR = gainL + WEBAUDIO_BLOCK_SIZE;
+  float* outputL = gainR + WEBAUDIO_BLOCK_SIZE;
+  float* outputR = outputL + WEBAUDIO_BLOCK_SIZE;
+  bool onLeft[WEBAUDIO_BLOCK_SIZE];
+
+  for (uint32_t i = 0; i < WEBAUDIO_BLOCK_SIZE; ++i) {
+    inputL[i] = float(i) / WEBAUDIO_BLOCK_SIZE;
+    inputR[i] = 1.0f - float(i) / WEBAUDIO_BLOCK_SIZE;
+    gainL[i] = 0.25f + float(i % 7) / 10;
+    gainR[i] = 0.75f - float(i % 5) / 10;
+    // Exercise mixed lanes within a single vector.
+    onLeft[i] = (i % 3) == 0;
+  }
+
+  AudioBlockPanStereoToStereo(inputL, inputR, gainL, gainR, onLeft,
+                              outputL, outputR);
+
+  for (uint32_t i = 0; i < WEBAUDIO_BLOCK_SIZE; ++i) {
+    float expectedL, expectedR;
+    if (onLeft[i]) {
+      expectedL = inputL[i] + inputR[i] * gainL[i];
+      expectedR = inputR[i] * gainR[i];
+    } else {
+      expectedL = inputL[i] * gainL[i];
+      expectedR = inputR[i] + inputL[i] * gainR[i];
+    }
+    EXPECT_FLOAT_EQ(expectedL, outputL[i]) << "left sample " << i;
+    EXPECT_FLOAT_EQ(expectedR, outputR[i]) << "right sample " << i;
+  }
+}
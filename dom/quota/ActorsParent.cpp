@@ -44,6 +44,8 @@
 #include "mozilla/Preferences.h"
 #include "mozilla/Services.h"
 #include "mozilla/StaticPtr.h"
+#include "mozilla/Telemetry.h"
+#include "mozilla/TimeStamp.h"
 #include "mozilla/TypeTraits.h"
 #include "mozilla/Unused.h"
 #include "mozStorageCID.h"
@@ -5102,6 +5104,8 @@ QuotaManager::EnsureOriginIsInitializedInternal(
       return NS_OK;
     }
   } else if (!mTemporaryStorageInitialized) {
+    const TimeStamp startTime = TimeStamp::Now();
+
     rv = InitializeRepository(aPersistenceType);
     if (NS_WARN_IF(NS_FAILED(rv))) {
       // We have to cleanup partially initialized quota.
@@ -5140,6 +5144,36 @@ QuotaManager::EnsureOriginIsInitializedInternal(
 
     mTemporaryStorageInitialized = true;
 
+    // Every origin directory is scanned (and every client asked for its usage)
+    // before the first temporary storage open can proceed, so keep track of
+    // how long that takes and how many origins it covers.
+    Telemetry::AccumulateTimeDelta(Telemetry::QM_TEMPORARY_STORAGE_INIT_TIME_MS,
+                                   startTime);
+
+    uint32_t originCount = 0;
+    {
+      MutexAutoLock lock(mQuotaMutex);
+
+      for (auto iter = mGroupInfoPairs.Iter(); !iter.Done(); iter.Next()) {
+        GroupInfoPair* pair = iter.UserData();
+        MOZ_ASSERT(pair);
+
+        RefPtr<GroupInfo> groupInfo =
+          pair->LockedGetGroupInfo(PERSISTENCE_TYPE_TEMPORARY);
+        if (groupInfo) {
+          originCount += groupInfo->mOriginInfos.Length();
+        }
+
+        groupInfo = pair->LockedGetGroupInfo(PERSISTENCE_TYPE_DEFAULT);
+        if (groupInfo) {
+          originCount += groupInfo->mOriginInfos.Length();
+        }
+      }
+    }
+
+    Telemetry::Accumulate(Telemetry::QM_TEMPORARY_STORAGE_INIT_ORIGINS,
+                          originCount);
+
     CheckTemporaryStorageLimits();
   }
 
@@ -1300,6 +1300,8 @@ ScriptLoader::ProcessScriptElement(nsIScriptElement* aElement)
       request = mPreloads[i].mRequest;
       request->mElement = aElement;
       nsString preloadCharset(mPreloads[i].mCharset);
+      Telemetry::AccumulateTimeDelta(Telemetry::DOM_SCRIPT_PRELOAD_TO_USE_MS,
+                                     mPreloads[i].mPreloadTime);
       mPreloads.RemoveElementAt(i);
 
       // Double-check that the charset the preload used is the same as
@@ -3084,6 +3086,7 @@ ScriptLoader::PreloadURI(nsIURI* aURI, const nsAString& aCharset,
   PreloadInfo* pi = mPreloads.AppendElement();
   pi->mRequest = request;
   pi->mCharset = aCharset;
+  pi->mPreloadTime = TimeStamp::Now();
 }
 
 void
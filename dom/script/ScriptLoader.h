@@ -25,6 +25,7 @@
 #include "mozilla/dom/SRICheck.h"
 #include "mozilla/MozPromise.h"
 #include "mozilla/net/ReferrerPolicy.h"
+#include "mozilla/TimeStamp.h"
 #include "mozilla/Vector.h"
 
 class nsIURI;
@@ -513,6 +514,8 @@ private:
   {
     RefPtr<ScriptLoadRequest> mRequest;
     nsString mCharset;
+    // When the preload was started, for DOM_SCRIPT_PRELOAD_TO_USE_MS.
+    TimeStamp mPreloadTime;
   };
 
   friend void ImplCycleCollectionUnlink(ScriptLoader::PreloadInfo& aField);
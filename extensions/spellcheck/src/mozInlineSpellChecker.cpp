@@ -1504,6 +1504,11 @@ nsresult mozInlineSpellChecker::DoSpellCheck(mozInlineSpellWordUtil& aWordUtil,
   nsAutoString wordText;
   RefPtr<nsRange> wordRange;
   bool dontCheckWord;
+  // Consecutive words usually live in the same text node, and whether a node
+  // is spellcheckable depends only on it and its ancestors, so remember the
+  // answer for the last node rather than walking up the tree for every word.
+  nsINode* lastCheckedNode = nullptr;
+  bool lastNodeIsSpellCheckable = false;
   while (NS_SUCCEEDED(aWordUtil.GetNextWord(wordText,
                                             getter_AddRefs(wordRange),
                                             &dontCheckWord)) &&
@@ -1568,7 +1573,11 @@ nsresult mozInlineSpellChecker::DoSpellCheck(mozInlineSpellWordUtil& aWordUtil,
       continue;
 
     // some nodes we don't spellcheck
-    if (!ShouldSpellCheckNode(textEditor, beginNode)) {
+    if (beginNode != lastCheckedNode) {
+      lastCheckedNode = beginNode;
+      lastNodeIsSpellCheckable = ShouldSpellCheckNode(textEditor, beginNode);
+    }
+    if (!lastNodeIsSpellCheckable) {
       continue;
     }
 
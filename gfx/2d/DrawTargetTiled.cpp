@@ -6,6 +6,7 @@
 #include "DrawTargetTiled.h"
 #include "Logging.h"
 #include "PathHelpers.h"
+#include "Tools.h"
 
 using namespace std;
 
@@ -108,8 +109,6 @@ DrawTargetTiled::DetachAllSnapshots()
 
 TILED_COMMAND(Flush)
 TILED_COMMAND4(DrawFilter, FilterNode*, const Rect&, const Point&, const DrawOptions&)
-TILED_COMMAND1(ClearRect, const Rect&)
-TILED_COMMAND4(MaskSurface, const Pattern&, SourceSurface*, Point, const DrawOptions&)
 TILED_COMMAND5(FillGlyphs, ScaledFont*, const GlyphBuffer&, const Pattern&, const DrawOptions&, const GlyphRenderingOptions*)
 TILED_COMMAND3(Mask, const Pattern&, const Pattern&, const DrawOptions&)
 
@@ -230,6 +229,40 @@ DrawTargetTiled::DrawSurface(SourceSurface* aSurface, const Rect& aDest, const R
   }
 }
 
+void
+DrawTargetTiled::ClearRect(const Rect& aRect)
+{
+  Rect deviceRect = mTransform.TransformBounds(aRect);
+  for (size_t i = 0; i < mTiles.size(); i++) {
+    if (!mTiles[i].mClippedOut &&
+        deviceRect.Intersects(Rect(mTiles[i].mTileOrigin.x,
+                                   mTiles[i].mTileOrigin.y,
+                                   mTiles[i].mDrawTarget->GetSize().width,
+                                   mTiles[i].mDrawTarget->GetSize().height))) {
+      mTiles[i].mDrawTarget->ClearRect(aRect);
+    }
+  }
+}
+
+void
+DrawTargetTiled::MaskSurface(const Pattern& aSource, SourceSurface* aMask, Point aOffset, const DrawOptions& aDrawOptions)
+{
+  // Unbounded operators affect pixels outside the mask, so those still have
+  // to go to every tile.
+  bool bounded = IsOperatorBoundByMask(aDrawOptions.mCompositionOp);
+  Rect deviceRect = mTransform.TransformBounds(Rect(aOffset, Size(aMask->GetSize())));
+  for (size_t i = 0; i < mTiles.size(); i++) {
+    if (!mTiles[i].mClippedOut &&
+        (!bounded ||
+         deviceRect.Intersects(Rect(mTiles[i].mTileOrigin.x,
+                                    mTiles[i].mTileOrigin.y,
+                                    mTiles[i].mDrawTarget->GetSize().width,
+                                    mTiles[i].mDrawTarget->GetSize().height)))) {
+      mTiles[i].mDrawTarget->MaskSurface(aSource, aMask, aOffset, aDrawOptions);
+    }
+  }
+}
+
 void
 DrawTargetTiled::FillRect(const Rect& aRect, const Pattern& aPattern, const DrawOptions& aDrawOptions)
 {
@@ -36,6 +36,7 @@
 #include "GLDefs.h"
 #include "GLLibraryLoader.h"
 #include "nsISupportsImpl.h"
+#include "nsRegionFwd.h"
 #include "plstr.h"
 #include "GLContextTypes.h"
 #include "SurfaceTypes.h"
@@ -3310,6 +3311,17 @@ public:
      */
     virtual bool SwapBuffers() { return false; }
 
+    /**
+     * Like SwapBuffers, but tells the window system that only aDamage (in
+     * window coordinates, top-left origin) changed since the last swap, so
+     * that it can present or recomposite just that area.  The whole back
+     * buffer must still be valid.  Contexts without damage support fall
+     * back to a plain SwapBuffers.
+     */
+    virtual bool SwapBuffersWithDamage(const gfx::IntRegion& aDamage) {
+        return SwapBuffers();
+    }
+
     /**
      * Defines a two-dimensional texture image for context target surface
      */
@@ -60,6 +60,7 @@
 #include "mozilla/widget/CompositorWidget.h"
 #include "nsDebug.h"
 #include "nsIWidget.h"
+#include "nsRegion.h"
 #include "nsThreadUtils.h"
 #include "ScopedGLHelpers.h"
 #include "TextureImageEGL.h"
@@ -425,6 +426,41 @@ GLContextEGL::SwapBuffers()
     }
 }
 
+bool
+GLContextEGL::SwapBuffersWithDamage(const gfx::IntRegion& aDamage)
+{
+    EGLSurface surface = mSurfaceOverride != EGL_NO_SURFACE
+                          ? mSurfaceOverride
+                          : mSurface;
+    if (!surface) {
+        return false;
+    }
+
+    if (!sEGLLibrary.HasSwapBuffersWithDamage() || aDamage.IsEmpty()) {
+        return sEGLLibrary.fSwapBuffers(EGL_DISPLAY(), surface);
+    }
+
+    EGLint height = 0;
+    if (!sEGLLibrary.fQuerySurface(EGL_DISPLAY(), surface, LOCAL_EGL_HEIGHT, &height)) {
+        return sEGLLibrary.fSwapBuffers(EGL_DISPLAY(), surface);
+    }
+
+    // EGL damage rects are x, y, width, height with a bottom-left origin.
+    nsTArray<EGLint> rects;
+    rects.SetCapacity(aDamage.GetNumRects() * 4);
+    for (auto iter = aDamage.RectIter(); !iter.Done(); iter.Next()) {
+        const gfx::IntRect& r = iter.Get();
+        rects.AppendElement(r.x);
+        rects.AppendElement(height - r.YMost());
+        rects.AppendElement(r.Width());
+        rects.AppendElement(r.Height());
+    }
+
+    return sEGLLibrary.fSwapBuffersWithDamage(EGL_DISPLAY(), surface,
+                                              rects.Elements(),
+                                              rects.Length() / 4);
+}
+
 void
 GLContextEGL::GetWSIInfo(nsCString* const out) const
 {
@@ -57,6 +57,8 @@ static const char* sEGLExtensionNames[] = {
     "EGL_EXT_device_query",
     "EGL_NV_stream_consumer_gltexture_yuv",
     "EGL_ANGLE_stream_producer_d3d_texture_nv12",
+    "EGL_KHR_swap_buffers_with_damage",
+    "EGL_EXT_swap_buffers_with_damage",
 };
 
 #if defined(ANDROID)
@@ -653,6 +655,20 @@ GLLibraryEGL::EnsureInitialized(bool forceAccel, nsACString* const out_failureId
         }
     }
 
+    if (HasSwapBuffersWithDamage()) {
+        // Both extensions expose the same entry point under different suffixes.
+        const GLLibraryLoader::SymLoadStruct swapDamageSymbols[] = {
+            { (PRFuncPtr*)&mSymbols.fSwapBuffersWithDamage,
+              { "eglSwapBuffersWithDamageKHR", "eglSwapBuffersWithDamageEXT", nullptr } },
+            END_OF_SYMBOLS
+        };
+        if (!fnLoadSymbols(swapDamageSymbols)) {
+            NS_ERROR("EGL supports swap_buffers_with_damage without exposing its functions!");
+            MarkExtensionUnsupported(KHR_swap_buffers_with_damage);
+            MarkExtensionUnsupported(EXT_swap_buffers_with_damage);
+        }
+    }
+
     mInitialized = true;
     reporter.SetSuccessful();
     return true;
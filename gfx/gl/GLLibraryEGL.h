@@ -111,6 +111,8 @@ public:
         EXT_device_query,
         NV_stream_consumer_gltexture_yuv,
         ANGLE_stream_producer_d3d_texture_nv12,
+        KHR_swap_buffers_with_damage,
+        EXT_swap_buffers_with_damage,
         Extensions_Max
     };
 
@@ -118,6 +120,11 @@ public:
         return mAvailableExtensions[aKnownExtension];
     }
 
+    bool HasSwapBuffersWithDamage() const {
+        return IsExtensionSupported(KHR_swap_buffers_with_damage) ||
+               IsExtensionSupported(EXT_swap_buffers_with_damage);
+    }
+
     void MarkExtensionUnsupported(EGLExtensions aKnownExtension) {
         mAvailableExtensions[aKnownExtension] = false;
     }
@@ -239,6 +246,10 @@ public:
     EGLBoolean fSwapBuffers(EGLDisplay dpy, EGLSurface surface) const
         WRAP(  fSwapBuffers(dpy, surface) )
 
+    // KHR_swap_buffers_with_damage / EXT_swap_buffers_with_damage
+    EGLBoolean fSwapBuffersWithDamage(EGLDisplay dpy, EGLSurface surface, const EGLint* rects, EGLint n_rects) const
+        WRAP(  fSwapBuffersWithDamage(dpy, surface, rects, n_rects) )
+
     EGLBoolean fCopyBuffers(EGLDisplay dpy, EGLSurface surface, EGLNativePixmapType target) const
         WRAP(  fCopyBuffers(dpy, surface, target) )
 
@@ -418,6 +429,8 @@ private:
                                               EGLint config_size, EGLint* num_config);
         EGLBoolean (GLAPIENTRY * fWaitNative)(EGLint engine);
         EGLBoolean (GLAPIENTRY * fSwapBuffers)(EGLDisplay dpy, EGLSurface surface);
+        EGLBoolean (GLAPIENTRY * fSwapBuffersWithDamage)(EGLDisplay dpy, EGLSurface surface,
+                                                         const EGLint* rects, EGLint n_rects);
         EGLBoolean (GLAPIENTRY * fCopyBuffers)(EGLDisplay dpy, EGLSurface surface,
                                                EGLNativePixmapType target);
         const GLubyte* (GLAPIENTRY * fQueryString)(EGLDisplay, EGLint name);
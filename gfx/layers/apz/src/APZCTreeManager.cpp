@@ -26,6 +26,7 @@
 #include "mozilla/layers/LayerMetricsWrapper.h"
 #include "mozilla/layers/WebRenderScrollDataWrapper.h"
 #include "mozilla/MouseEvents.h"
+#include "mozilla/Telemetry.h"          // for Telemetry
 #include "mozilla/mozalloc.h"           // for operator new
 #include "mozilla/TouchEvents.h"
 #include "mozilla/Preferences.h"        // for Preferences
@@ -2062,8 +2063,11 @@ APZCTreeManager::GetTargetAPZC(const ScreenPoint& aPoint,
   HitTestingTreeNode* scrollbarNode = nullptr;
   ParentLayerPoint point = ViewAs<ParentLayerPixel>(aPoint,
     PixelCastJustification::ScreenIsParentLayerForRoot);
+  TimeStamp hitTestStart = TimeStamp::Now();
   RefPtr<AsyncPanZoomController> target = GetAPZCAtPoint(mRootNode, point,
       &hitResult, &scrollbarNode);
+  Telemetry::Accumulate(Telemetry::APZ_HIT_TEST_TIME_US,
+      static_cast<uint32_t>((TimeStamp::Now() - hitTestStart).ToMicroseconds()));
 
   if (aOutHitResult) {
     *aOutHitResult = hitResult;
@@ -2217,6 +2221,11 @@ APZCTreeManager::GetAPZCAtPoint(HitTestingTreeNode* aNode,
             hitTestPoints.top().x, hitTestPoints.top().y, aNode);
           return TraversalFlag::Skip;
         }
+        if (!aNode->GetLastChild() && aNode->IsHitRegionEmpty()) {
+          // A leaf that can't be hit won't change the result, so don't bother
+          // computing and inverting its transform.
+          return TraversalFlag::Skip;
+        }
         // First check the subtree rooted at this node, because deeper nodes
         // are more "in front".
         Maybe<LayerPoint> hitTestPoint = aNode->Untransform(
@@ -268,6 +268,13 @@ HitTestingTreeNode::IsOutsideClip(const ParentLayerPoint& aPoint) const
   return (mClipRegion.isSome() && !mClipRegion->Contains(aPoint.x, aPoint.y));
 }
 
+bool
+HitTestingTreeNode::IsHitRegionEmpty() const
+{
+  return (mOverride & EventRegionsOverride::ForceEmptyHitRegion) ||
+         mEventRegions.mHitRegion.IsEmpty();
+}
+
 Maybe<LayerPoint>
 HitTestingTreeNode::Untransform(const ParentLayerPoint& aPoint,
                                 const LayerToParentLayerMatrix4x4& aTransform) const
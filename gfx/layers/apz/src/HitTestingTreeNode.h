@@ -91,6 +91,9 @@ public:
                       const Maybe<ParentLayerIntRegion>& aClipRegion,
                       const EventRegionsOverride& aOverride);
   bool IsOutsideClip(const ParentLayerPoint& aPoint) const;
+  /* Returns true if no point can ever hit this node itself (its children
+   * may still be hit). */
+  bool IsHitRegionEmpty() const;
 
   /* Scrollbar info */
 
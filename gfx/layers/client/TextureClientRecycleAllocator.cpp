@@ -136,9 +136,7 @@ TextureClientRecycleAllocator::TextureClientRecycleAllocator(KnowsCompositor* aA
 TextureClientRecycleAllocator::~TextureClientRecycleAllocator()
 {
   MutexAutoLock lock(mLock);
-  while (!mPooledClients.empty()) {
-    mPooledClients.pop();
-  }
+  mPooledClients.clear();
   MOZ_ASSERT(mInUseClients.empty());
 }
 
@@ -178,19 +176,34 @@ TextureClientRecycleAllocator::CreateOrRecycle(ITextureClientAllocationHelper& a
       return nullptr;
     }
     if (!mPooledClients.empty()) {
-      textureHolder = mPooledClients.top();
-      mPooledClients.pop();
-      // If the texture's allocator is not open or a pooled TextureClient is
-      // not compatible, release it.
-      if (!textureHolder->GetTextureClient()->GetAllocator()->IPCOpen() ||
-          !aHelper.IsCompatible(textureHolder->GetTextureClient())) {
-        // Release TextureClient.
-        RefPtr<Runnable> task = new TextureClientReleaseTask(textureHolder->GetTextureClient());
-        textureHolder->ClearTextureClient();
-        textureHolder = nullptr;
-        mSurfaceAllocator->GetTextureForwarder()->GetMessageLoop()->PostTask(task.forget());
-      } else {
+      // Release pooled TextureClients whose allocator is no longer open.
+      for (auto it = mPooledClients.begin(); it != mPooledClients.end();) {
+        if (!(*it)->GetTextureClient()->GetAllocator()->IPCOpen()) {
+          ReleasePooledClient(*it);
+          it = mPooledClients.erase(it);
+        } else {
+          ++it;
+        }
+      }
+
+      // Reuse the most recently pooled compatible TextureClient, so that a
+      // client alternating between a few sizes or formats doesn't thrash the
+      // pool.
+      for (auto it = mPooledClients.rbegin(); it != mPooledClients.rend(); ++it) {
+        if (aHelper.IsCompatible((*it)->GetTextureClient())) {
+          textureHolder = *it;
+          mPooledClients.erase(std::next(it).base());
+          break;
+        }
+      }
+
+      if (textureHolder) {
         textureHolder->GetTextureClient()->RecycleTexture(aHelper.mTextureFlags);
+      } else if (!mPooledClients.empty()) {
+        // Nothing fits; release the oldest pooled TextureClient, since its
+        // size or format has likely gone out of use.
+        ReleasePooledClient(mPooledClients.front());
+        mPooledClients.pop_front();
       }
     }
   }
@@ -229,13 +242,19 @@ TextureClientRecycleAllocator::Allocate(gfx::SurfaceFormat aFormat,
                                          aSelector, aTextureFlags, aAllocFlags);
 }
 
+void
+TextureClientRecycleAllocator::ReleasePooledClient(TextureClientHolder* aHolder)
+{
+  RefPtr<Runnable> task = new TextureClientReleaseTask(aHolder->GetTextureClient());
+  aHolder->ClearTextureClient();
+  mSurfaceAllocator->GetTextureForwarder()->GetMessageLoop()->PostTask(task.forget());
+}
+
 void
 TextureClientRecycleAllocator::ShrinkToMinimumSize()
 {
   MutexAutoLock lock(mLock);
-  while (!mPooledClients.empty()) {
-    mPooledClients.pop();
-  }
+  mPooledClients.clear();
   // We can not clear using TextureClients safely.
   // Just clear WillRecycle here.
   std::map<TextureClient*, RefPtr<TextureClientHolder> >::iterator it;
@@ -249,9 +268,7 @@ void
 TextureClientRecycleAllocator::Destroy()
 {
   MutexAutoLock lock(mLock);
-  while (!mPooledClients.empty()) {
-    mPooledClients.pop();
-  }
+  mPooledClients.clear();
   mIsDestroyed = true;
 }
 
@@ -270,7 +287,7 @@ TextureClientRecycleAllocator::RecycleTextureClient(TextureClient* aClient)
       textureHolder = mInUseClients[aClient]; // Keep reference count of TextureClientHolder within lock.
       if (textureHolder->WillRecycle() &&
           !mIsDestroyed && mPooledClients.size() < mMaxPooledSize) {
-        mPooledClients.push(textureHolder);
+        mPooledClients.push_back(textureHolder);
       }
       mInUseClients.erase(aClient);
     }
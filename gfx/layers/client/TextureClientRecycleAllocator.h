@@ -6,8 +6,8 @@
 #ifndef MOZILLA_GFX_TEXTURECLIENT_RECYCLE_ALLOCATOR_H
 #define MOZILLA_GFX_TEXTURECLIENT_RECYCLE_ALLOCATOR_H
 
+#include <deque>
 #include <map>
-#include <stack>
 #include "mozilla/gfx/Types.h"
 #include "mozilla/layers/TextureForwarder.h"
 #include "mozilla/RefPtr.h"
@@ -120,13 +120,18 @@ protected:
   friend class DefaultTextureClientAllocationHelper;
   void RecycleTextureClient(TextureClient* aClient) override;
 
+  // Releases the TextureClient of a holder taken out of mPooledClients on the
+  // forwarder's message loop. Must be called with mLock held.
+  void ReleasePooledClient(TextureClientHolder* aHolder);
+
   static const uint32_t kMaxPooledSized = 2;
   uint32_t mMaxPooledSize;
 
   std::map<TextureClient*, RefPtr<TextureClientHolder> > mInUseClients;
 
   // stack is good from Graphics cache usage point of view.
-  std::stack<RefPtr<TextureClientHolder> > mPooledClients;
+  // Pooled clients, oldest first.
+  std::deque<RefPtr<TextureClientHolder> > mPooledClients;
   Mutex mLock;
   bool mIsDestroyed;
 };
@@ -72,6 +72,13 @@ Diagnostics::GetFrameOverlayString(const GPUStats& aStats)
     gpuTimeString = nsPrintfCString("%0.1fms", mGPUDrawMs.Average()).get();
   }
 
+  std::string drawCallsString;
+  if (aStats.mDrawCalls) {
+    drawCallsString = nsPrintfCString("%u", aStats.mDrawCalls.value()).get();
+  } else {
+    drawCallsString = "N/A";
+  }
+
   // DL  = nsDisplayListBuilder
   // FLB = FrameLayerBuilder
   // R   = ClientLayerManager::EndTransaction
@@ -81,12 +88,13 @@ Diagnostics::GetFrameOverlayString(const GPUStats& aStats)
   // CC_BUILD = Container prepare/composite frame building
   // CC_EXEC  = Container render/composite drawing
   nsPrintfCString line1("FPS: %d (TXN: %d)", fps, txnFps);
-  nsPrintfCString line2("[CC] Build: %0.1fms Exec: %0.1fms GPU: %s Fill Ratio: %0.1f/%0.1f",
+  nsPrintfCString line2("[CC] Build: %0.1fms Exec: %0.1fms GPU: %s Fill Ratio: %0.1f/%0.1f Draws: %s",
     mPrepareMs.Average(),
     mCompositeMs.Average(),
     gpuTimeString.c_str(),
     pixelFillRatio,
-    screenFillRatio);
+    screenFillRatio,
+    drawCallsString.c_str());
   nsPrintfCString line3("[Content] DL: %0.1fms FLB: %0.1fms Raster: %0.1fms",
     mDlbMs.Average(),
     mFlbMs.Average(),
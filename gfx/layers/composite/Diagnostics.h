@@ -55,6 +55,7 @@ struct GPUStats
   uint32_t mScreenPixels;
   uint32_t mPixelsFilled;
   Maybe<float> mDrawTime;
+  Maybe<uint32_t> mDrawCalls;
 };
 
 // Collects various diagnostics about layers performance.
@@ -28,6 +28,7 @@
 #include "mozilla/layers/TextureHostOGL.h"  // for TextureHostOGL
 #include "mozilla/layers/PaintedLayerComposite.h"
 #include "mozilla/mozalloc.h"           // for operator delete, etc
+#include "mozilla/Telemetry.h"          // for Accumulate
 #include "mozilla/Unused.h"
 #include "nsCoord.h"                    // for NSAppUnitsToFloatPixels
 #include "nsDebug.h"                    // for NS_RUNTIMEABORT
@@ -177,6 +178,13 @@ LayerTransactionParent::RecvUpdate(const TransactionInfo& aInfo)
 
   MOZ_LAYERS_LOG(("[ParentSide] received txn with %zu edits", aInfo.cset().Length()));
 
+  // Full attribute updates are what make transactions large on pages with
+  // many layers; record how many each one carries.
+  Telemetry::Accumulate(Telemetry::LAYERS_TRANSACTION_ATTRIBUTE_UPDATES,
+                        aInfo.setAttrs().Length());
+  Telemetry::Accumulate(Telemetry::LAYERS_TRANSACTION_SIMPLE_ATTRIBUTE_UPDATES,
+                        aInfo.setSimpleAttrs().Length());
+
   UpdateFwdTransactionId(aInfo.fwdTransactionId());
   AutoClearReadLocks clearLocks(mReadLocks);
 
@@ -26,6 +26,7 @@
 #include "mozilla/gfx/gfxVars.h"        // for gfxVars
 #include "mozilla/layers/LayerManagerComposite.h"  // for LayerComposite, etc
 #include "mozilla/layers/CompositingRenderTargetOGL.h"
+#include "mozilla/layers/Diagnostics.h"  // for GPUStats
 #include "mozilla/layers/Effects.h"     // for EffectChain, TexturedEffect, etc
 #include "mozilla/layers/TextureHost.h"  // for TextureSource, etc
 #include "mozilla/layers/TextureHostOGL.h"  // for TextureSourceOGL, etc
@@ -94,6 +95,7 @@ CompositorOGL::CompositorOGL(CompositorBridgeParent* aParent,
   , mHasBGRA(0)
   , mUseExternalSurfaceSize(aUseExternalSurfaceSize)
   , mFrameInProgress(false)
+  , mDrawCalls(0)
   , mDestroyed(false)
   , mViewportSize(0, 0)
   , mCurrentProgram(nullptr)
@@ -676,6 +678,13 @@ CompositorOGL::BeginFrame(const nsIntRegion& aInvalidRegion,
 
   mPixelsPerFrame = width * height;
   mPixelsFilled = 0;
+  mDrawCalls = 0;
+
+  mFrameDamage.SetEmpty();
+  if (gfxPrefs::GLSwapWithDamage() && !mUseExternalSurfaceSize) {
+    mFrameDamage.And(aInvalidRegion, rect);
+    mFrameDamage.MoveBy(-rect.TopLeft());
+  }
 
 #ifdef MOZ_WIDGET_ANDROID
   TexturePoolOGL::Fill(gl());
@@ -1502,6 +1511,7 @@ CompositorOGL::BindAndDrawGeometry(ShaderProgramOGL* aProgram,
   InitializeVAO(kTexCoordinateAttributeIndex, 2, stride, 2 * sizeof(GLfloat));
 
   mGLContext->fDrawArrays(LOCAL_GL_TRIANGLES, 0, vertices.Length());
+  mDrawCalls++;
 
   mGLContext->fDisableVertexAttribArray(kCoordinateAttributeIndex);
   mGLContext->fDisableVertexAttribArray(kTexCoordinateAttributeIndex);
@@ -1559,6 +1569,7 @@ CompositorOGL::BindAndDrawQuads(ShaderProgramOGL *aProg,
   // We are using GL_TRIANGLES here because the Mac Intel drivers fail to properly
   // process uniform arrays with GL_TRIANGLE_STRIP. Go figure.
   mGLContext->fDrawArrays(LOCAL_GL_TRIANGLES, 0, 6 * aQuads);
+  mDrawCalls++;
   mGLContext->fDisableVertexAttribArray(kCoordinateAttributeIndex);
   mGLContext->fBindBuffer(LOCAL_GL_ARRAY_BUFFER, 0);
   LayerScope::SetDrawRects(aQuads, aLayerRects, aTextureRects);
@@ -1574,6 +1585,13 @@ CompositorOGL::InitializeVAO(const GLuint aAttrib, const GLint aComponents,
   mGLContext->fEnableVertexAttribArray(aAttrib);
 }
 
+void
+CompositorOGL::GetFrameStats(GPUStats* aStats)
+{
+  Compositor::GetFrameStats(aStats);
+  aStats->mDrawCalls = Some(mDrawCalls);
+}
+
 void
 CompositorOGL::EndFrame()
 {
@@ -1615,7 +1633,13 @@ CompositorOGL::EndFrame()
     mTexturePool->EndFrame();
   }
 
-  mGLContext->SwapBuffers();
+  if (mFrameDamage.IsEmpty()) {
+    mGLContext->SwapBuffers();
+  } else {
+    // The whole frame was redrawn, so this is only a hint that lets the
+    // window system skip recompositing the unchanged parts of the window.
+    mGLContext->SwapBuffersWithDamage(mFrameDamage);
+  }
   mGLContext->fBindBuffer(LOCAL_GL_ARRAY_BUFFER, 0);
 
   // Unbind all textures
@@ -177,6 +177,8 @@ public:
 
   virtual void EndFrame() override;
 
+  virtual void GetFrameStats(GPUStats* aStats) override;
+
   virtual bool SupportsPartialTextureUpdate() override;
 
   virtual bool CanUseCanvasLayerForSize(const gfx::IntSize &aSize) override
@@ -308,6 +310,18 @@ private:
    */
   bool mFrameInProgress;
 
+  /**
+   * Number of draw calls issued for the current frame, shown in the
+   * diagnostics overlay.
+   */
+  uint32_t mDrawCalls;
+
+  /**
+   * The part of the window invalidated this frame, in window coordinates.
+   * Passed to the GL context as a damage hint when presenting.
+   */
+  nsIntRegion mFrameDamage;
+
   /*
    * Clear aRect on current render target.
    */
@@ -67,6 +67,9 @@ struct _qcms_transform {
 	struct precache_output *output_table_g;
 	struct precache_output *output_table_b;
 
+	/* the device RGB for each gray input level, when precaching */
+	unsigned char (*gray_output_table)[3];
+
 	void (*transform_fn)(struct _qcms_transform *transform, unsigned char *src, unsigned char *dest, size_t length);
 };
 
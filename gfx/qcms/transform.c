@@ -393,21 +393,40 @@ static void qcms_transform_data_graya_out_lut(qcms_transform *transform, unsigne
 }
 
 
-static void qcms_transform_data_gray_out_precache(qcms_transform *transform, unsigned char *src, unsigned char *dest, size_t length)
+/* A gray input has only 256 possible values, so with precached output tables
+ * the whole transform collapses to one table of device RGB triples. */
+static unsigned char (*build_gray_output_table(qcms_transform *transform))[3]
 {
+	unsigned char (*table)[3] = malloc(256 * sizeof(*table));
 	unsigned int i;
-	for (i = 0; i < length; i++) {
-		unsigned char device = *src++;
+	if (!table)
+		return NULL;
+
+	for (i = 0; i < 256; i++) {
 		uint16_t gray;
 
-		float linear = transform->input_gamma_table_gray[device];
+		float linear = transform->input_gamma_table_gray[i];
 
 		/* we could round here... */
 		gray = linear * PRECACHE_OUTPUT_MAX;
 
-		dest[OUTPUT_R_INDEX] = transform->output_table_r->data[gray];
-		dest[OUTPUT_G_INDEX] = transform->output_table_g->data[gray];
-		dest[OUTPUT_B_INDEX] = transform->output_table_b->data[gray];
+		table[i][0] = transform->output_table_r->data[gray];
+		table[i][1] = transform->output_table_g->data[gray];
+		table[i][2] = transform->output_table_b->data[gray];
+	}
+	return table;
+}
+
+static void qcms_transform_data_gray_out_precache(qcms_transform *transform, unsigned char *src, unsigned char *dest, size_t length)
+{
+	unsigned int i;
+	unsigned char (*table)[3] = transform->gray_output_table;
+	for (i = 0; i < length; i++) {
+		const unsigned char *out = table[*src++];
+
+		dest[OUTPUT_R_INDEX] = out[0];
+		dest[OUTPUT_G_INDEX] = out[1];
+		dest[OUTPUT_B_INDEX] = out[2];
 		dest += RGB_OUTPUT_COMPONENTS;
 	}
 }
@@ -415,19 +434,14 @@ static void qcms_transform_data_gray_out_precache(qcms_transform *transform, uns
 static void qcms_transform_data_graya_out_precache(qcms_transform *transform, unsigned char *src, unsigned char *dest, size_t length)
 {
 	unsigned int i;
+	unsigned char (*table)[3] = transform->gray_output_table;
 	for (i = 0; i < length; i++) {
-		unsigned char device = *src++;
+		const unsigned char *out = table[*src++];
 		unsigned char alpha = *src++;
-		uint16_t gray;
 
-		float linear = transform->input_gamma_table_gray[device];
-
-		/* we could round here... */
-		gray = linear * PRECACHE_OUTPUT_MAX;
-
-		dest[OUTPUT_R_INDEX] = transform->output_table_r->data[gray];
-		dest[OUTPUT_G_INDEX] = transform->output_table_g->data[gray];
-		dest[OUTPUT_B_INDEX] = transform->output_table_b->data[gray];
+		dest[OUTPUT_R_INDEX] = out[0];
+		dest[OUTPUT_G_INDEX] = out[1];
+		dest[OUTPUT_B_INDEX] = out[2];
 		dest[OUTPUT_A_INDEX] = alpha;
 		dest += RGBA_OUTPUT_COMPONENTS;
 	}
@@ -990,6 +1004,7 @@ void qcms_transform_release(qcms_transform *t)
 		free(t->input_gamma_table_b);
 
 	free(t->input_gamma_table_gray);
+	free(t->gray_output_table);
 
 	free(t->output_gamma_lut_r);
 	free(t->output_gamma_lut_g);
@@ -1374,6 +1389,11 @@ qcms_transform* qcms_transform_create(
 		}
 
 		if (precache) {
+			transform->gray_output_table = build_gray_output_table(transform);
+			if (!transform->gray_output_table) {
+				qcms_transform_release(transform);
+				return NO_MEM_TRANSFORM;
+			}
 			if (in_type == QCMS_DATA_GRAY_8) {
 				transform->transform_fn = qcms_transform_data_gray_out_precache;
 			} else {
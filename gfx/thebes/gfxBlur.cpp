@@ -550,6 +550,10 @@ CreateBoxShadow(DrawTarget* aDestDrawTarget,
   return result.forget();
 }
 
+// The largest area (in device pixels) of a full-size, unsliced box shadow
+// that we'll keep in the blur cache.
+static const int64_t kMaxCachedDestRectBlurArea = 512 * 512;
+
 static already_AddRefed<SourceSurface>
 GetBlur(gfxContext* aDestinationCtx,
         const IntSize& aRectSize,
@@ -577,16 +581,25 @@ GetBlur(gfxContext* aDestinationCtx,
   // Instead just render the blur ourself here as one image and send it over for printing.
   // TODO: May need to change this with the blob renderer in WR since it also records.
   Matrix destMatrix = ToMatrix(aDestinationCtx->CurrentMatrix());
+  bool isRecording = aDestinationCtx->GetDrawTarget()->IsRecording();
   bool useDestRect = !destMatrix.IsRectilinear() || destMatrix.HasNonIntegerTranslation() ||
-                     aDestinationCtx->GetDrawTarget()->IsRecording();
+                     isRecording;
   if (useDestRect) {
     minSize = aRectSize;
   }
   aOutMinSize = minSize;
 
+  // Full-size blurs are still worth caching when they're small enough, since
+  // a shadow under a fractional translation (e.g. while scrolling or during a
+  // transform animation) would otherwise be blurred again on every paint.
+  bool useCache = !isRecording &&
+                  (!useDestRect ||
+                   int64_t(minSize.width) * minSize.height <=
+                     kMaxCachedDestRectBlurArea);
+
   DrawTarget* destDT = aDestinationCtx->GetDrawTarget();
 
-  if (!useDestRect) {
+  if (useCache) {
     BlurCacheData* cached = gBlurCache->Lookup(minSize, aBlurRadius,
                                                aCornerRadii, aShadowColor,
                                                destDT->GetBackendType());
@@ -609,7 +622,7 @@ GetBlur(gfxContext* aDestinationCtx,
     boxShadow = opt;
   }
 
-  if (!useDestRect) {
+  if (useCache) {
     CacheBlur(destDT, minSize, aBlurRadius, aCornerRadii, aShadowColor,
               aOutBlurMargin, boxShadow);
   }
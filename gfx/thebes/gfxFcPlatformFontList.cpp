@@ -1223,6 +1223,7 @@ gfxFontconfigFont::GetScaledFont(mozilla::gfx::DrawTarget *aTarget)
 
 gfxFcPlatformFontList::gfxFcPlatformFontList()
     : mLocalNames(64)
+    , mLocalNamesInitialized(false)
     , mGenericMappings(32)
     , mFcSubstituteCache(64)
     , mLastConfig(nullptr)
@@ -1327,6 +1328,28 @@ gfxFcPlatformFontList::AddFontSetFamilies(FcFontSet* aFontSet, bool aAppFonts)
 
         NS_ASSERTION(fontFamily, "font must belong to a font family");
         fontFamily->AddFontPattern(font);
+    }
+}
+
+void
+gfxFcPlatformFontList::AddFontSetLocalNames(FcFontSet* aFontSet)
+{
+    if (!aFontSet) {
+        return;
+    }
+
+    nsAutoString familyName;
+    for (int f = 0; f < aFontSet->nfont; f++) {
+        FcPattern* font = aFontSet->fonts[f];
+
+        uint32_t cIndex = FindCanonicalNameIndex(font, FC_FAMILYLANG);
+        FcChar8* canonical = nullptr;
+        FcPatternGetString(font, FC_FAMILY, cIndex, &canonical);
+        if (!canonical) {
+            continue;
+        }
+        familyName.Truncate();
+        AppendUTF8toUTF16(ToCharPtr(canonical), familyName);
 
         // map the psname, fullname ==> font family for local font lookups
         nsAutoString psname, fullname;
@@ -1342,12 +1365,24 @@ gfxFcPlatformFontList::AddFontSetFamilies(FcFontSet* aFontSet, bool aAppFonts)
     }
 }
 
+void
+gfxFcPlatformFontList::InitLocalNames()
+{
+    mLocalNamesInitialized = true;
+
+    AddFontSetLocalNames(FcConfigGetFonts(nullptr, FcSetSystem));
+#ifdef MOZ_BUNDLED_FONTS
+    AddFontSetLocalNames(FcConfigGetFonts(nullptr, FcSetApplication));
+#endif
+}
+
 nsresult
 gfxFcPlatformFontList::InitFontListForPlatform()
 {
     mLastConfig = FcConfigGetCurrent();
 
     mLocalNames.Clear();
+    mLocalNamesInitialized = false;
     mFcSubstituteCache.Clear();
 
     // iterate over available fonts
@@ -1477,6 +1512,10 @@ gfxFcPlatformFontList::LookupLocalFont(const nsAString& aFontName,
                                        int16_t aStretch,
                                        uint8_t aStyle)
 {
+    if (!mLocalNamesInitialized) {
+        InitLocalNames();
+    }
+
     nsAutoString keyName(aFontName);
     ToLowerCase(keyName);
 
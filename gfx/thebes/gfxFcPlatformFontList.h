@@ -290,6 +290,11 @@ protected:
     // aAppFonts indicates whether this is the system or application fontset.
     void AddFontSetFamilies(FcFontSet* aFontSet, bool aAppFonts);
 
+    // Populate mLocalNames from the fonts in a font set. This is only needed
+    // for src:local() lookups, so it is deferred until the first one.
+    void AddFontSetLocalNames(FcFontSet* aFontSet);
+    void InitLocalNames();
+
     // figure out which families fontconfig maps a generic to
     // (aGeneric assumed already lowercase)
     PrefFontList* FindGenericFamilies(const nsAString& aGeneric,
@@ -314,6 +319,7 @@ protected:
     nsBaseHashtable<nsStringHashKey,
                     nsCountedRef<FcPattern>,
                     FcPattern*> mLocalNames;
+    bool mLocalNamesInitialized;
 
     // caching generic/lang ==> font family list
     nsClassHashtable<nsCStringHashKey,
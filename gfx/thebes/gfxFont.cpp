@@ -2535,6 +2535,26 @@ gfxFont::AgeCachedWords()
     }
 }
 
+void
+gfxFont::PruneCachedWords(uint32_t aMaxEntries)
+{
+    if (!mWordCache) {
+        return;
+    }
+
+    for (auto it = mWordCache->Iter(); !it.Done(); it.Next()) {
+        CacheHashEntry *entry = it.Get();
+        if (!entry->mShapedWord || entry->mShapedWord->GetAge() > 0) {
+            it.Remove();
+        }
+    }
+
+    if (mWordCache->Count() > aMaxEntries) {
+        NS_WARNING("flushing shaped-word cache");
+        ClearCachedWords();
+    }
+}
+
 void
 gfxFont::NotifyGlyphsChanged()
 {
@@ -2581,12 +2601,13 @@ gfxFont::GetShapedWord(DrawTarget *aDrawTarget,
                        RoundingFlags aRounding,
                        gfxTextPerfMetrics *aTextPerf GFX_MAYBE_UNUSED)
 {
-    // if the cache is getting too big, flush it and start over
+    // if the cache is getting too big, drop the words that have gone unused
+    // since the last aging pass (or flush it and start over if that's not
+    // enough), so that common words in a long document stay cached
     uint32_t wordCacheMaxEntries =
         gfxPlatform::GetPlatform()->WordCacheMaxEntries();
     if (mWordCache->Count() > wordCacheMaxEntries) {
-        NS_WARNING("flushing shaped-word cache");
-        ClearCachedWords();
+        PruneCachedWords(wordCacheMaxEntries);
     }
 
     // if there's a cached entry for this word, just return it
@@ -1335,6 +1335,9 @@ public:
     uint32_t IncrementAge() {
         return ++mAgeCounter;
     }
+    uint32_t GetAge() const {
+        return mAgeCounter;
+    }
 
     // Helper used when hashing a word for the shaped-word caches
     static uint32_t HashMix(uint32_t aHash, char16_t aCh)
@@ -1854,6 +1857,11 @@ public:
     // so that they'll expire after a sufficient period of non-use
     void AgeCachedWords();
 
+    // Called when the word cache has grown past aMaxEntries: discard words
+    // that haven't been used since the last aging pass, and only flush the
+    // whole cache if that doesn't bring it back under the limit.
+    void PruneCachedWords(uint32_t aMaxEntries);
+
     // Discard all cached word records; called on memory-pressure notification.
     void ClearCachedWords() {
         if (mWordCache) {
@@ -16,9 +16,13 @@
 #include "mozilla/dom/network/Types.h"
 #include "mozilla/dom/ScreenOrientation.h"
 #include "mozilla/fallback/FallbackScreenConfiguration.h"
+#include "mozilla/Maybe.h"
 #include "mozilla/Observer.h"
+#include "mozilla/TimeStamp.h"
 #include "mozilla/Unused.h"
 #include "nsAutoPtr.h"
+#include "nsComponentManagerUtils.h"
+#include "nsITimer.h"
 #include "WindowIdentifier.h"
 
 using namespace mozilla;
@@ -30,6 +34,28 @@ namespace hal_sandbox {
 
 static bool sHalChildDestroyed = false;
 
+// Motion and orientation sensors stream readings continuously, often faster
+// than content can use them, and each reading supersedes the previous one.
+// Forward at most one reading of each such sensor per this interval to each
+// content process, holding back the latest reading until the interval is up.
+static const double kMinContinuousSensorIntervalMs = 16.0;
+
+static bool
+IsContinuousSensor(SensorType aSensor)
+{
+  switch (aSensor) {
+    case SENSOR_ORIENTATION:
+    case SENSOR_ACCELERATION:
+    case SENSOR_LINEAR_ACCELERATION:
+    case SENSOR_GYROSCOPE:
+    case SENSOR_ROTATION_VECTOR:
+    case SENSOR_GAME_ROTATION_VECTOR:
+      return true;
+    default:
+      return false;
+  }
+}
+
 bool
 HalChildDestroyed()
 {
@@ -304,6 +330,10 @@ public:
          switchDevice < NUM_SWITCH_DEVICE; ++switchDevice) {
       hal::UnregisterSwitchObserver(SwitchDevice(switchDevice), this);
     }
+    if (mSensorTimer) {
+      mSensorTimer->Cancel();
+      mSensorTimer = nullptr;
+    }
   }
 
   virtual mozilla::ipc::IPCResult
@@ -465,11 +495,75 @@ public:
   virtual mozilla::ipc::IPCResult
   RecvDisableSensorNotifications(const SensorType &aSensor) override {
     hal::UnregisterSensorObserver(aSensor, this);
+    mPendingSensorData[aSensor].reset();
     return IPC_OK();
   }
 
   void Notify(const SensorData& aSensorData) override {
-    Unused << SendNotifySensorChange(aSensorData);
+    SensorType sensor = aSensorData.sensor();
+    if (!IsContinuousSensor(sensor)) {
+      Unused << SendNotifySensorChange(aSensorData);
+      return;
+    }
+
+    // Replace any reading of this sensor that is still being held back, so
+    // the last reading of a burst is always the one that gets sent.
+    mPendingSensorData[sensor] = Some(aSensorData);
+    SendPendingSensorData();
+  }
+
+  static void
+  SensorTimerCallback(nsITimer* aTimer, void* aClosure)
+  {
+    static_cast<HalParent*>(aClosure)->SendPendingSensorData();
+  }
+
+  // Send the held back readings whose interval is up, and arm the timer for
+  // the earliest of the rest.
+  void SendPendingSensorData() {
+    TimeStamp now = TimeStamp::Now();
+    TimeDuration interval =
+      TimeDuration::FromMilliseconds(kMinContinuousSensorIntervalMs);
+    TimeStamp nextDeadline;
+
+    for (int32_t sensor = SENSOR_UNKNOWN + 1;
+         sensor < NUM_SENSOR_TYPE; ++sensor) {
+      if (mPendingSensorData[sensor].isNothing()) {
+        continue;
+      }
+
+      TimeStamp& last = mLastSensorNotification[sensor];
+      if (last.IsNull() || now - last >= interval) {
+        Unused << SendNotifySensorChange(mPendingSensorData[sensor].ref());
+        mPendingSensorData[sensor].reset();
+        last = now;
+        continue;
+      }
+
+      TimeStamp deadline = last + interval;
+      if (nextDeadline.IsNull() || deadline < nextDeadline) {
+        nextDeadline = deadline;
+      }
+    }
+
+    if (nextDeadline.IsNull()) {
+      return;
+    }
+
+    if (!mSensorTimer) {
+      mSensorTimer = do_CreateInstance("@mozilla.org/timer;1");
+      if (!mSensorTimer) {
+        return;
+      }
+    }
+
+    // Round up, so the timer doesn't fire before the interval is up.
+    uint32_t delay = uint32_t((nextDeadline - now).ToMilliseconds()) + 1;
+    mSensorTimer->InitWithNamedFuncCallback(SensorTimerCallback,
+                                            this,
+                                            delay,
+                                            nsITimer::TYPE_ONE_SHOT,
+                                            "hal_sandbox::HalParent::SendPendingSensorData");
   }
 
   virtual mozilla::ipc::IPCResult
@@ -541,6 +635,14 @@ public:
   {
     Unused << SendNotifySystemTimezoneChange(aSystemTimezoneChangeInfo);
   }
+
+private:
+  // When a reading of each continuous sensor was last sent to this process.
+  TimeStamp mLastSensorNotification[NUM_SENSOR_TYPE];
+  // The latest reading of each continuous sensor that arrived too soon after
+  // the previous one was sent, and the timer that sends it.
+  Maybe<SensorData> mPendingSensorData[NUM_SENSOR_TYPE];
+  nsCOMPtr<nsITimer> mSensorTimer;
 };
 
 class HalChild : public PHalChild {
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 
+#include "GeckoProfiler.h"
 #include "mozilla/ClearOnShutdown.h"
 #include "mozilla/Monitor.h"
 #include "nsCOMPtr.h"
@@ -24,6 +25,10 @@
 #include "IDecodingTask.h"
 #include "RasterImage.h"
 
+#if defined(MOZ_MEMORY)
+# include "mozmemory.h"
+#endif
+
 using std::max;
 using std::min;
 
@@ -94,10 +99,16 @@ public:
       return;
     }
 
-    if (task->Priority() == TaskPriority::eHigh) {
-      mHighPriorityQueue.AppendElement(Move(task));
-    } else {
-      mLowPriorityQueue.AppendElement(Move(task));
+    switch (task->Priority()) {
+      case TaskPriority::eHigh:
+        mHighPriorityQueue.AppendElement(Move(task));
+        break;
+      case TaskPriority::eMedium:
+        mMediumPriorityQueue.AppendElement(Move(task));
+        break;
+      default:
+        mLowPriorityQueue.AppendElement(Move(task));
+        break;
     }
 
     mMonitor.Notify();
@@ -113,6 +124,10 @@ public:
         return PopWorkFromQueue(mHighPriorityQueue);
       }
 
+      if (!mMediumPriorityQueue.IsEmpty()) {
+        return PopWorkFromQueue(mMediumPriorityQueue);
+      }
+
       if (!mLowPriorityQueue.IsEmpty()) {
         return PopWorkFromQueue(mLowPriorityQueue);
       }
@@ -152,6 +167,7 @@ private:
   // mMonitor guards the queues and mShuttingDown.
   Monitor mMonitor;
   nsTArray<RefPtr<IDecodingTask>> mHighPriorityQueue;
+  nsTArray<RefPtr<IDecodingTask>> mMediumPriorityQueue;
   nsTArray<RefPtr<IDecodingTask>> mLowPriorityQueue;
   bool mShuttingDown;
 };
@@ -171,12 +187,22 @@ public:
     nsCOMPtr<nsIThread> thisThread;
     nsThreadManager::get().GetCurrentThread(getter_AddRefs(thisThread));
 
+#if defined(MOZ_MEMORY)
+    // Decoders make many small, short-lived allocations. Give each worker its
+    // own jemalloc arena so that they don't all contend for the lock of the
+    // shared default arena. Decoding threads live until shutdown, so the
+    // arenas aren't churned.
+    jemalloc_thread_local_arena(true);
+#endif
+
     do {
       Work work = mImpl->PopWork();
       switch (work.mType) {
-        case Work::Type::TASK:
+        case Work::Type::TASK: {
+          AutoProfilerTracing tracing("Paint", "DecodeTask");
           work.mTask->Run();
           break;
+        }
 
         case Work::Type::SHUTDOWN:
           DecodePoolImpl::ShutdownThread(thisThread);
@@ -23,6 +23,9 @@ DecodedSurfaceProvider::DecodedSurfaceProvider(NotNull<RasterImage*> aImage,
   , mImage(aImage.get())
   , mMutex("mozilla::image::DecodedSurfaceProvider")
   , mDecoder(aDecoder.get())
+  , mPriority(bool(aDecoder->GetDecoderFlags() & DecoderFlags::IS_VISIBLE)
+                ? TaskPriority::eMedium
+                : TaskPriority::eLow)
 {
   MOZ_ASSERT(!mDecoder->IsMetadataDecode(),
              "Use MetadataDecodingTask for metadata decodes");
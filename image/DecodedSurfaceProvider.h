@@ -55,9 +55,10 @@ public:
   void Run() override;
   bool ShouldPreferSyncRun() const override;
 
-  // Full decodes are low priority compared to metadata decodes because they
-  // don't block layout or page load.
-  TaskPriority Priority() const override { return TaskPriority::eLow; }
+  // Full decodes are lower priority than metadata decodes because they don't
+  // block layout or page load. Decodes for images that are being painted go
+  // ahead of speculative ones, though.
+  TaskPriority Priority() const override { return mPriority; }
 
 
 private:
@@ -81,6 +82,9 @@ private:
 
   /// A drawable reference to our service; used for locking.
   DrawableFrameRef mLockRef;
+
+  /// Our scheduling priority, fixed when the decoder is created.
+  const TaskPriority mPriority;
 };
 
 } // namespace image
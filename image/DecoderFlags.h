@@ -23,7 +23,13 @@ enum class DecoderFlags : uint8_t
   FIRST_FRAME_ONLY               = 1 << 0,
   IS_REDECODE                    = 1 << 1,
   IMAGE_IS_TRANSIENT             = 1 << 2,
-  ASYNC_NOTIFY                   = 1 << 3
+  ASYNC_NOTIFY                   = 1 << 3,
+
+  /**
+   * The decode was triggered by drawing the image, so the image is visible
+   * right now and the decode should be scheduled ahead of speculative ones.
+   */
+  IS_VISIBLE                     = 1 << 4
 };
 MOZ_MAKE_ENUM_CLASS_BITWISE_OPERATORS(DecoderFlags)
 
@@ -27,6 +27,7 @@ class RasterImage;
 enum class TaskPriority : uint8_t
 {
   eLow,
+  eMedium,  // Full decodes of images that are currently being painted.
   eHigh
 };
 
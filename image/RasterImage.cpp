@@ -316,7 +316,8 @@ RasterImage::LookupFrameInternal(const IntSize& aSize,
 DrawableSurface
 RasterImage::LookupFrame(const IntSize& aSize,
                          uint32_t aFlags,
-                         PlaybackType aPlaybackType)
+                         PlaybackType aPlaybackType,
+                         bool aIsVisible /* = false */)
 {
   MOZ_ASSERT(NS_IsMainThread());
 
@@ -351,7 +352,7 @@ RasterImage::LookupFrame(const IntSize& aSize,
                !mAnimationState || mAnimationState->KnownFrameCount() < 1,
                "Animated frames should be locked");
 
-    bool ranSync = Decode(requestedSize, aFlags, aPlaybackType);
+    bool ranSync = Decode(requestedSize, aFlags, aPlaybackType, aIsVisible);
 
     // If we can or did sync decode, we should already have the frame.
     if (ranSync || (aFlags & FLAG_SYNC_DECODE)) {
@@ -1229,7 +1230,8 @@ LaunchDecodingTask(IDecodingTask* aTask,
 bool
 RasterImage::Decode(const IntSize& aSize,
                     uint32_t aFlags,
-                    PlaybackType aPlaybackType)
+                    PlaybackType aPlaybackType,
+                    bool aIsVisible /* = false */)
 {
   MOZ_ASSERT(NS_IsMainThread());
 
@@ -1263,6 +1265,9 @@ RasterImage::Decode(const IntSize& aSize,
   if (mHasBeenDecoded) {
     decoderFlags |= DecoderFlags::IS_REDECODE;
   }
+  if (aIsVisible) {
+    decoderFlags |= DecoderFlags::IS_VISIBLE;
+  }
 
   SurfaceFlags surfaceFlags = ToSurfaceFlags(aFlags);
   if (IsOpaque()) {
@@ -1485,7 +1490,8 @@ RasterImage::Draw(gfxContext* aContext,
                  : aFlags & ~FLAG_HIGH_QUALITY_SCALING;
 
   DrawableSurface surface =
-    LookupFrame(aSize, flags, ToPlaybackType(aWhichFrame));
+    LookupFrame(aSize, flags, ToPlaybackType(aWhichFrame),
+                /* aIsVisible = */ true);
   if (!surface) {
     // Getting the frame (above) touches the image and kicks off decoding.
     if (mDrawStartTime.IsNull()) {
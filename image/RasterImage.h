@@ -286,12 +286,16 @@ private:
    * kick off an async decode so that the surface is (hopefully) available next
    * time it's requested.
    *
+   * @aIsVisible should be true if the image is being painted, so that any
+   * decode we start is scheduled ahead of speculative ones.
+   *
    * @return a drawable surface, which may be empty if the requested surface
    *         could not be found.
    */
   DrawableSurface LookupFrame(const gfx::IntSize& aSize,
                               uint32_t aFlags,
-                              PlaybackType aPlaybackType);
+                              PlaybackType aPlaybackType,
+                              bool aIsVisible = false);
 
   /// Helper method for LookupFrame().
   LookupResult LookupFrameInternal(const gfx::IntSize& aSize,
@@ -335,11 +339,15 @@ private:
    * It's an error to call Decode() before this image's intrinsic size is
    * available. A metadata decode must successfully complete first.
    *
+   * If @aIsVisible is true, the decode is prioritized over decodes for images
+   * that aren't being painted.
+   *
    * Returns true of the decode was run synchronously.
    */
   bool Decode(const gfx::IntSize& aSize,
               uint32_t aFlags,
-              PlaybackType aPlaybackType);
+              PlaybackType aPlaybackType,
+              bool aIsVisible = false);
 
   /**
    * Creates and runs a metadata decoder, either synchronously or
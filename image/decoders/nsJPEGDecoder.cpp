@@ -60,6 +60,26 @@ GetICCProfile(struct jpeg_decompress_struct& info)
   return profile;
 }
 
+/**
+ * @return the largest IDCT scaling denominator (1, 2, 4 or 8) that lets
+ * libjpeg produce an image no smaller than @aTargetSize from one of size
+ * @aOriginalSize.
+ */
+static unsigned int
+DCTScaleDenominator(const gfx::IntSize& aOriginalSize,
+                    const gfx::IntSize& aTargetSize)
+{
+  for (unsigned int denom = 8; denom > 1; denom /= 2) {
+    // libjpeg rounds scaled dimensions up.
+    int32_t width = (aOriginalSize.width + denom - 1) / denom;
+    int32_t height = (aOriginalSize.height + denom - 1) / denom;
+    if (width >= aTargetSize.width && height >= aTargetSize.height) {
+      return denom;
+    }
+  }
+  return 1;
+}
+
 METHODDEF(void) init_source (j_decompress_ptr jd);
 METHODDEF(boolean) fill_input_buffer (j_decompress_ptr jd);
 METHODDEF(void) skip_input_data (j_decompress_ptr jd, long num_bytes);
@@ -378,9 +398,25 @@ nsJPEGDecoder::ReadJPEGData(const char* aData, size_t aLength)
     mInfo.buffered_image = mDecodeStyle == PROGRESSIVE &&
                            jpeg_has_multiple_scans(&mInfo);
 
+    // When downscaling by a factor of two or more, have libjpeg do the bulk of
+    // it in the IDCT, which is much cheaper than decoding every pixel at full
+    // size and throwing most of them away in the Downscaler.
+    if (mDownscaler) {
+      mInfo.scale_num = 1;
+      mInfo.scale_denom = DCTScaleDenominator(Size(), OutputSize());
+    }
+
     /* Used to set up image size so arrays can be allocated */
     jpeg_calc_output_dimensions(&mInfo);
 
+    // If the IDCT alone got us to the target size, there's nothing left for
+    // the Downscaler to do; write rows straight into the frame instead.
+    if (mDownscaler &&
+        int32_t(mInfo.output_width) == OutputSize().width &&
+        int32_t(mInfo.output_height) == OutputSize().height) {
+      mDownscaler.reset();
+    }
+
     MOZ_ASSERT(!mImageData, "Already have a buffer allocated?");
     nsresult rv = AllocateFrame(/* aFrameNum = */ 0, OutputSize(),
                                 FullOutputFrame(), SurfaceFormat::B8G8R8X8);
@@ -394,7 +430,9 @@ nsJPEGDecoder::ReadJPEGData(const char* aData, size_t aLength)
     MOZ_ASSERT(mImageData, "Should have a buffer now");
 
     if (mDownscaler) {
-      nsresult rv = mDownscaler->BeginFrame(Size(), Nothing(),
+      nsresult rv = mDownscaler->BeginFrame(nsIntSize(mInfo.output_width,
+                                                      mInfo.output_height),
+                                            Nothing(),
                                             mImageData,
                                             /* aHasAlpha = */ false);
       if (NS_FAILED(rv)) {
@@ -722,13 +760,32 @@ nsJPEGDecoder::OutputScanlines(bool* suspend)
 
   if (mDownscaler && mDownscaler->HasInvalidation()) {
     DownscalerInvalidRect invalidRect = mDownscaler->TakeInvalidRect();
+
+    // The Downscaler only saw the IDCT-scaled image; map its rect back to
+    // image space.
+    if (mInfo.scale_denom > 1) {
+      invalidRect.mOriginalSizeRect.Scale(int32_t(mInfo.scale_denom));
+      invalidRect.mOriginalSizeRect =
+        invalidRect.mOriginalSizeRect.Intersect(
+          nsIntRect(0, 0, Size().width, Size().height));
+    }
+
     PostInvalidation(invalidRect.mOriginalSizeRect,
                      Some(invalidRect.mTargetSizeRect));
     MOZ_ASSERT(!mDownscaler->HasInvalidation());
   } else if (!mDownscaler && top != mInfo.output_scanline) {
-    PostInvalidation(nsIntRect(0, top,
-                               mInfo.output_width,
-                               mInfo.output_scanline - top));
+    nsIntRect outputRect(0, top,
+                         mInfo.output_width,
+                         mInfo.output_scanline - top);
+    if (mInfo.scale_denom > 1) {
+      nsIntRect imageRect = outputRect;
+      imageRect.Scale(int32_t(mInfo.scale_denom));
+      imageRect = imageRect.Intersect(nsIntRect(0, 0, Size().width,
+                                                Size().height));
+      PostInvalidation(imageRect, Some(outputRect));
+    } else {
+      PostInvalidation(outputRect);
+    }
   }
 }
 
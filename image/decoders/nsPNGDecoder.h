@@ -104,6 +104,7 @@ public:
   nsIntRect mFrameRect;
   uint8_t* mCMSLine;
   uint8_t* interlacebuf;
+  uint32_t* mPackedRow;  // Scratch row for bulk RGBA -> OS_RGBA conversion.
   qcms_profile* mInProfile;
   qcms_transform* mTransform;
   gfx::SurfaceFormat mFormat;
@@ -134,6 +134,11 @@ static const uint32_t kMinTelemetryIPCWriteLatencyMs = 1;
 // (IPC_SYNC_MAIN_LATENCY_MS and IPC_SYNC_RECEIVE_MS).
 static const uint32_t kMinTelemetrySyncIPCLatencyMs = 1;
 
+// Note: as above, this captures messages that waited 500us and more in the
+// receiver's pending queue before being dispatched
+// (IPC_RECEIVE_QUEUE_LATENCY_MS).
+static const uint32_t kMinTelemetryIPCQueueLatencyMs = 1;
+
 const int32_t MessageChannel::kNoTimeout = INT32_MIN;
 
 // static
@@ -1872,6 +1877,16 @@ MessageChannel::RunMessage(MessageTask& aTask)
         mMaybeDeferredPendingCount--;
     }
 
+    if (NS_IsMainThread()) {
+        uint32_t latencyMs =
+            round((TimeStamp::Now() - aTask.QueuedTime()).ToMilliseconds());
+        if (latencyMs >= kMinTelemetryIPCQueueLatencyMs) {
+            Telemetry::Accumulate(Telemetry::IPC_RECEIVE_QUEUE_LATENCY_MS,
+                                  nsDependentCString(msg.name()),
+                                  latencyMs);
+        }
+    }
+
     if (IsOnCxxStack() && msg.is_interrupt() && msg.is_reply()) {
         // We probably just received a reply in a nested loop for an
         // Interrupt call sent before entering that loop.
@@ -1888,6 +1903,7 @@ MessageChannel::MessageTask::MessageTask(MessageChannel* aChannel, Message&& aMe
   : CancelableRunnable(StringFromIPCMessageType(aMessage.type()))
   , mChannel(aChannel)
   , mMessage(Move(aMessage))
+  , mQueuedTime(TimeStamp::Now())
   , mScheduled(false)
 {
 }
@@ -16,6 +16,7 @@
 #include "mozilla/DebugOnly.h"
 #include "mozilla/Monitor.h"
 #include "mozilla/MozPromise.h"
+#include "mozilla/TimeStamp.h"
 #include "mozilla/Vector.h"
 #if defined(OS_WIN)
 #include "mozilla/ipc/Neutering.h"
@@ -564,6 +565,9 @@ class MessageChannel : HasResultCodes, MessageLoop::DestructionObserver
         Message& Msg() { return mMessage; }
         const Message& Msg() const { return mMessage; }
 
+        // When the message was queued for dispatch on this side.
+        const TimeStamp& QueuedTime() const { return mQueuedTime; }
+
         bool GetAffectedSchedulerGroups(nsTArray<RefPtr<SchedulerGroup>>& aGroups) override;
 
     private:
@@ -573,6 +577,7 @@ class MessageChannel : HasResultCodes, MessageLoop::DestructionObserver
 
         MessageChannel* mChannel;
         Message mMessage;
+        TimeStamp mQueuedTime;
         bool mScheduled : 1;
     };
 
@@ -200,6 +200,7 @@ namespace JS {
     _(CantInlineDebuggee)                                               \
     _(CantInlineExceededDepth)                                          \
     _(CantInlineExceededTotalBytecodeLength)                            \
+    _(CantInlineExceededHotBytecodeLength)                              \
     _(CantInlineBigCaller)                                              \
     _(CantInlineBigCallee)                                              \
     _(CantInlineBigCalleeInlinedBytecodeLength)                         \
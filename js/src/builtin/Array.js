@@ -34,6 +34,11 @@ function ArrayIndexOf(searchElement/*, fromIndex*/) {
             k = 0;
     }
 
+    /* Search the dense elements in native code if possible. */
+    var index = callFunction(ArrayNativeIndexOf, O, searchElement, k, len);
+    if (index !== undefined)
+        return index;
+
     /* Step 9. */
     for (; k < len; k++) {
         if (k in O && O[k] === searchElement)
@@ -680,6 +685,11 @@ function ArrayIncludes(searchElement, fromIndex = 0) {
             k = 0;
     }
 
+    // Search the dense elements in native code if possible.
+    var found = callFunction(ArrayNativeIncludes, O, searchElement, k, len);
+    if (found !== undefined)
+        return found;
+
     // Step 10.
     while (k < len) {
         // Steps a-c.
@@ -858,14 +858,21 @@ js::atomics_wake(JSContext* cx, unsigned argc, Value* vp)
             count = 0.0;
     }
 
-    AutoLockFutexAPI lock;
+    // Nothing can be woken, so don't contend for the runtime-wide futex lock
+    // with the threads that are waiting.
+    if (count == 0) {
+        r.setInt32(0);
+        return true;
+    }
 
     Rooted<SharedArrayBufferObject*> sab(cx, view->bufferShared());
     SharedArrayRawBuffer* sarb = sab->rawBufferObject();
     int32_t woken = 0;
 
+    AutoLockFutexAPI lock;
+
     FutexWaiter* waiters = sarb->waiters();
-    if (waiters && count > 0) {
+    if (waiters) {
         FutexWaiter* iter = waiters;
         do {
             FutexWaiter* c = iter;
@@ -19,8 +19,8 @@
 //   formatters:
 //     A Record storing formatters consistent with the above
 //     runtimeDefaultLocale/localTZA values, for use with the appropriate
-//     ES6 toLocale*String Date method when called with its first two
-//     arguments having the value |undefined|.
+//     ES6 toLocale*String Date method when called without options and with
+//     either no locales or a single locale string.
 //
 // The "formatters" Record has (some subset of) these properties, as determined
 // by all values of the first argument passed to |GetCachedFormat|:
@@ -29,6 +29,11 @@
 //   dateFormat: for Date's toLocaleDateString operation
 //   timeFormat: for Date's toLocaleTimeString operation
 //
+// Formatters for an explicit locale string are kept in a second Record,
+// "localeFormatters", which holds for each of the keys above the most
+// recently used { locale, format } pair.  Making this a one-entry cache keeps
+// it bounded however many locales a page uses.
+//
 // Using this cache, then, requires
 // 1) verifying the current runtimeDefaultLocale/icuDefaultTimeZone are
 //    consistent with cached values, then
@@ -41,32 +46,55 @@ var dateTimeFormatCache = new Record();
  * Get a cached DateTimeFormat formatter object, created like so:
  *
  *   var opts = ToDateTimeOptions(undefined, required, defaults);
- *   return new Intl.DateTimeFormat(undefined, opts);
+ *   return new Intl.DateTimeFormat(locale, opts);
  *
  * |format| must be a key from the "formatters" Record described above.
+ * |locale| is either undefined or a string.
  */
-function GetCachedFormat(format, required, defaults) {
+function GetCachedFormat(format, required, defaults, locale) {
     assert(format === "dateTimeFormat" ||
            format === "dateFormat" ||
            format === "timeFormat",
            "unexpected format key: please update the comment by " +
            "dateTimeFormatCache");
+    assert(locale === undefined || typeof locale === "string",
+           "only undefined or a single locale string can be cached");
 
     var runtimeDefaultLocale = RuntimeDefaultLocale();
     var icuDefaultTimeZone = intl_defaultTimeZone();
 
-    var formatters;
+    var formatters, localeFormatters;
     if (dateTimeFormatCache.runtimeDefaultLocale !== runtimeDefaultLocale ||
         dateTimeFormatCache.icuDefaultTimeZone !== icuDefaultTimeZone)
     {
         formatters = dateTimeFormatCache.formatters = new Record();
+        localeFormatters = dateTimeFormatCache.localeFormatters = new Record();
         dateTimeFormatCache.runtimeDefaultLocale = runtimeDefaultLocale;
         dateTimeFormatCache.icuDefaultTimeZone = icuDefaultTimeZone;
     } else {
         formatters = dateTimeFormatCache.formatters;
+        localeFormatters = dateTimeFormatCache.localeFormatters;
+    }
+
+    var fmt;
+    if (locale !== undefined) {
+        // The resolved locale of an explicit locale can still fall back to
+        // the default locale, so these entries are reset along with the
+        // others above.
+        var entry = localeFormatters[format];
+        if (entry !== undefined && entry.locale === locale)
+            return entry.format;
+
+        var localeOptions = ToDateTimeOptions(undefined, required, defaults);
+        fmt = intl_DateTimeFormat(locale, localeOptions);
+        entry = new Record();
+        entry.locale = locale;
+        entry.format = fmt;
+        localeFormatters[format] = entry;
+        return fmt;
     }
 
-    var fmt = formatters[format];
+    fmt = formatters[format];
     if (fmt === undefined) {
         var options = ToDateTimeOptions(undefined, required, defaults);
         fmt = formatters[format] = intl_DateTimeFormat(undefined, options);
@@ -94,10 +122,12 @@ function Date_toLocaleString() {
 
     // Step 5-6.
     var dateTimeFormat;
-    if (locales === undefined && options === undefined) {
+    if (options === undefined &&
+        (locales === undefined || typeof locales === "string"))
+    {
         // This cache only optimizes for the old ES5 toLocaleString without
-        // locales and options.
-        dateTimeFormat = GetCachedFormat("dateTimeFormat", "any", "all");
+        // options, and for the common case of a single locale string.
+        dateTimeFormat = GetCachedFormat("dateTimeFormat", "any", "all", locales);
     } else {
         options = ToDateTimeOptions(options, "any", "all");
         dateTimeFormat = intl_DateTimeFormat(locales, options);
@@ -127,10 +157,12 @@ function Date_toLocaleDateString() {
 
     // Step 5-6.
     var dateTimeFormat;
-    if (locales === undefined && options === undefined) {
+    if (options === undefined &&
+        (locales === undefined || typeof locales === "string"))
+    {
         // This cache only optimizes for the old ES5 toLocaleDateString without
-        // locales and options.
-        dateTimeFormat = GetCachedFormat("dateFormat", "date", "date");
+        // options, and for the common case of a single locale string.
+        dateTimeFormat = GetCachedFormat("dateFormat", "date", "date", locales);
     } else {
         options = ToDateTimeOptions(options, "date", "date");
         dateTimeFormat = intl_DateTimeFormat(locales, options);
@@ -160,10 +192,12 @@ function Date_toLocaleTimeString() {
 
     // Step 5-6.
     var dateTimeFormat;
-    if (locales === undefined && options === undefined) {
+    if (options === undefined &&
+        (locales === undefined || typeof locales === "string"))
+    {
         // This cache only optimizes for the old ES5 toLocaleTimeString without
-        // locales and options.
-        dateTimeFormat = GetCachedFormat("timeFormat", "time", "time");
+        // options, and for the common case of a single locale string.
+        dateTimeFormat = GetCachedFormat("timeFormat", "time", "time", locales);
     } else {
         options = ToDateTimeOptions(options, "time", "time");
         dateTimeFormat = intl_DateTimeFormat(locales, options);
@@ -368,7 +368,9 @@ MinorGC(JSContext* cx, unsigned argc, Value* vp)
     _("minEmptyChunkCount",         JSGC_MIN_EMPTY_CHUNK_COUNT,          true)  \
     _("maxEmptyChunkCount",         JSGC_MAX_EMPTY_CHUNK_COUNT,          true)  \
     _("compactingEnabled",          JSGC_COMPACTING_ENABLED,             true)  \
-    _("refreshFrameSlicesEnabled",  JSGC_REFRESH_FRAME_SLICES_ENABLED,   true)
+    _("refreshFrameSlicesEnabled",  JSGC_REFRESH_FRAME_SLICES_ENABLED,   true)  \
+    _("minFreeCommittedArenas",     JSGC_MIN_FREE_COMMITTED_ARENAS,      true)  \
+    _("highFrequencyDecommit",      JSGC_HIGH_FREQUENCY_DECOMMIT_ENABLED, true)
 
 static const struct ParamInfo {
     const char*     name;
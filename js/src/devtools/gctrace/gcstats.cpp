@@ -25,8 +25,15 @@
 #include <algorithm>
 #include <functional>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+// This is built standalone, without access to mfbt.
+#ifndef MOZ_FORMAT_PRINTF
+#define MOZ_FORMAT_PRINTF(stringIndex, firstToCheck) \
+    __attribute__((format(printf, stringIndex, firstToCheck)))
+#endif
+
 // State of the program
 
 enum Heap
@@ -164,6 +171,24 @@ Array<Array<uint64_t, MaxLifetimeBins>, FinalizerKinds> heapObjectCountByFinaliz
 Array<Array<uint64_t, MaxLifetimeBins>, MaxClasses> finalizedHeapObjectCountByClassAndLifetime;
 std::vector<Array<Array<uint64_t, MaxLifetimeBins>, HeapKinds> > objectCountByTypeHeapAndLifetime;
 
+// The size and lifetime of every thing, used to replay the allocation stream
+// against nurseries of different sizes.
+
+struct ThingLifetime
+{
+    uint64_t allocTime;
+    uint64_t deathTime;
+    uint64_t size;
+
+    ThingLifetime(uint64_t allocTime, uint64_t deathTime, uint64_t size)
+      : allocTime(allocTime), deathTime(deathTime), size(size) {}
+};
+
+std::vector<ThingLifetime> lifetimesByHeap[HeapKinds];
+
+const unsigned MinReplayNurseryLog = 18;  // 256 KB
+const unsigned MaxReplayNurseryLog = 25;  // 32 MB
+
 static void
 MOZ_FORMAT_PRINTF(1, 2)
 die(const char* format, ...)
@@ -220,6 +245,8 @@ static const char*
 allocKindName(AllocKind kind)
 {
     static const char* AllocKindNames[] = {
+        "Function",
+        "FunctionExt",
         "Object0",
         "Object0Bg",
         "Object2",
@@ -235,13 +262,18 @@ allocKindName(AllocKind kind)
         "Script",
         "LazyScript",
         "Shape",
+        "AccessorShape",
         "BaseShape",
-        "TypeObject",
+        "ObjectGroup",
         "FatInlineString",
         "String",
         "ExternalString",
+        "FatInlineAtom",
+        "Atom",
         "Symbol",
         "JitCode",
+        "Scope",
+        "RegExpShared",
         "Total"
     };
     assert(sizeof(AllocKindNames) / sizeof(const char*) == AugAllocKinds);
@@ -502,6 +534,141 @@ processAlloc(const AllocInfo& info, uint64_t finalizeTime)
     uint64_t size = thingSizes[info.kind];
     gcBytesAllocatedInSlice[timeslice] += size;
     gcBytesFreedInSlice[finalizeTime / timesliceSize] += size;
+
+    lifetimesByHeap[info.initialHeap].push_back(ThingLifetime(info.serial, finalizeTime, size));
+}
+
+static void
+recordLiveAtExit(const AllocMap& things)
+{
+    for (auto i = things.begin(); i != things.end(); ++i) {
+        const AllocInfo& info = i->second;
+        lifetimesByHeap[info.initialHeap].push_back(
+            ThingLifetime(info.serial, allocCount, thingSizes[info.kind]));
+    }
+}
+
+struct NurseryReplayResult
+{
+    uint64_t minorGCs;
+    uint64_t promotedBytes;
+    uint64_t peakTenuredBytes;
+    std::vector<uint64_t> promotedBytesByGC;
+};
+
+static void
+replayNursery(uint64_t nurseryBytes, NurseryReplayResult& result)
+{
+    /*
+     * Replay the nursery allocations in the trace against a nursery of the
+     * given size. A minor GC happens whenever the next allocation does not
+     * fit, and everything allocated since the last one that is still alive at
+     * that point is promoted.
+     *
+     * This relies on the lifetimes in the trace being accurate, so as with the
+     * lifetime outputs the trace should be taken with appropriate zeal.
+     */
+    const std::vector<ThingLifetime>& nursery = lifetimesByHeap[Nursery];
+
+    // Changes to the size of the tenured heap, as (time, delta) pairs.
+    std::vector<std::pair<uint64_t, int64_t> > tenuredChanges;
+    for (const ThingLifetime& thing : lifetimesByHeap[TenuredHeap]) {
+        tenuredChanges.push_back(std::make_pair(thing.allocTime, int64_t(thing.size)));
+        tenuredChanges.push_back(std::make_pair(thing.deathTime, -int64_t(thing.size)));
+    }
+
+    result.minorGCs = 0;
+    result.promotedBytes = 0;
+    result.promotedBytesByGC.clear();
+
+    uint64_t used = 0;
+    size_t first = 0;
+    for (size_t i = 0; i <= nursery.size(); ++i) {
+        if (i < nursery.size() && used + nursery[i].size <= nurseryBytes) {
+            used += nursery[i].size;
+            continue;
+        }
+
+        // Collect everything allocated since the last minor GC. Things still
+        // in the nursery when the trace ends are not collected.
+        if (i == nursery.size())
+            break;
+
+        uint64_t gcTime = nursery[i].allocTime;
+        uint64_t promoted = 0;
+        for (size_t j = first; j < i; ++j) {
+            const ThingLifetime& thing = nursery[j];
+            if (thing.deathTime > gcTime) {
+                promoted += thing.size;
+                tenuredChanges.push_back(std::make_pair(gcTime, int64_t(thing.size)));
+                tenuredChanges.push_back(std::make_pair(thing.deathTime, -int64_t(thing.size)));
+            }
+        }
+
+        ++result.minorGCs;
+        result.promotedBytes += promoted;
+        result.promotedBytesByGC.push_back(promoted);
+
+        first = i;
+        used = nursery[i].size;
+    }
+
+    // Deaths sort before allocations at the same time, so we don't overstate
+    // the peak.
+    std::sort(tenuredChanges.begin(), tenuredChanges.end());
+    int64_t tenuredBytes = 0;
+    int64_t peakTenuredBytes = 0;
+    for (auto& change : tenuredChanges) {
+        tenuredBytes += change.second;
+        peakTenuredBytes = std::max(peakTenuredBytes, tenuredBytes);
+    }
+    result.peakTenuredBytes = uint64_t(peakTenuredBytes);
+
+    std::sort(result.promotedBytesByGC.begin(), result.promotedBytesByGC.end());
+}
+
+static uint64_t
+percentile(const std::vector<uint64_t>& sorted, unsigned percent)
+{
+    if (sorted.empty())
+        return 0;
+    return sorted[(sorted.size() - 1) * percent / 100];
+}
+
+static void
+outputNurseryReplay(FILE* file)
+{
+    fprintf(file, "# Minor GCs and promotion when replaying the trace with different nursery sizes\n");
+    fprintf(file, "# Minor GC pause times are roughly proportional to the bytes promoted by each GC\n");
+    fprintf(file, "# NB invalid unless execution was traced with appropriate zeal\n");
+    fprintf(file, "# Total allocations: %" PRIu64 "\n", allocCount);
+    fprintf(file, "NurseryBytes, MinorGCs, PromotedBytes, PromotionRate, "
+                  "MedianPromotedPerGC, 90thPromotedPerGC, MaxPromotedPerGC, PeakTenuredBytes\n");
+
+    // Sort by allocation time, as things are recorded in the order they die.
+    std::sort(lifetimesByHeap[Nursery].begin(), lifetimesByHeap[Nursery].end(),
+              [] (const ThingLifetime& a, const ThingLifetime& b) {
+                  return a.allocTime < b.allocTime;
+              });
+
+    uint64_t nurseryAllocBytes = 0;
+    for (const ThingLifetime& thing : lifetimesByHeap[Nursery])
+        nurseryAllocBytes += thing.size;
+
+    NurseryReplayResult result;
+    for (unsigned log = MinReplayNurseryLog; log <= MaxReplayNurseryLog; ++log) {
+        uint64_t nurseryBytes = uint64_t(1) << log;
+        replayNursery(nurseryBytes, result);
+        double promotionRate =
+            nurseryAllocBytes ? 100.0 * result.promotedBytes / nurseryAllocBytes : 0.0;
+        fprintf(file, "%12" PRIu64 ", %8" PRIu64 ", %12" PRIu64 ", %6.2f, "
+                "%10" PRIu64 ", %10" PRIu64 ", %10" PRIu64 ", %12" PRIu64 "\n",
+                nurseryBytes, result.minorGCs, result.promotedBytes, promotionRate,
+                percentile(result.promotedBytesByGC, 50),
+                percentile(result.promotedBytesByGC, 90),
+                percentile(result.promotedBytesByGC, 100),
+                result.peakTenuredBytes);
+    }
 }
 
 static bool
@@ -746,9 +913,9 @@ processTraceFile(const char* filename)
     while ((maxTraces / timesliceSize ) > 1000)
         timesliceSize *= 2;
 
-    size_t maxTimeslices = maxTraces / timesliceSize;
-    gcBytesAllocatedInSlice.reserve(maxTimeslices);
-    gcBytesFreedInSlice.reserve(maxTimeslices);
+    size_t maxTimeslices = maxTraces / timesliceSize + 1;
+    gcBytesAllocatedInSlice.resize(maxTimeslices);
+    gcBytesFreedInSlice.resize(maxTimeslices);
     lifetimeBins = getBin(maxTraces) + 1;
     assert(lifetimeBins <= MaxLifetimeBins);
 
@@ -821,6 +988,9 @@ processTraceFile(const char* filename)
     lifetimeBins = getBin(allocCount) + 1;
     assert(lifetimeBins <= MaxLifetimeBins);
 
+    recordLiveAtExit(nurseryThings);
+    recordLiveAtExit(tenuredThings);
+
     fclose(file);
 }
 
@@ -869,5 +1039,6 @@ main(int argc, const char* argv[])
                    std::bind(outputLifetimeByType, _1, Nursery));
     withOutputFile(outputBase, "lifetimeByTypeForHeap",
                    std::bind(outputLifetimeByType, _1, TenuredHeap));
+    withOutputFile(outputBase, "nurseryReplay", outputNurseryReplay);
     return 0;
 }
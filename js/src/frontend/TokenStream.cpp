@@ -1442,6 +1442,8 @@ TokenStream::getTokenInternal(TokenKind* ttp, Modifier modifier)
 
       identifier:
         for (;;) {
+            userbuf.skipAsciiIdentifierChars();
+
             c = getCharIgnoreEOL();
             if (c == EOF)
                 break;
@@ -1803,6 +1805,7 @@ TokenStream::getTokenInternal(TokenKind* ttp, Modifier modifier)
             }
 
         skipline:
+            userbuf.skipCharsUntilEOL();
             do {
                 if (!getChar(&c))
                     goto error;
@@ -1818,6 +1821,8 @@ TokenStream::getTokenInternal(TokenKind* ttp, Modifier modifier)
             unsigned linenoBefore = lineno;
 
             do {
+                userbuf.skipOrdinaryBlockCommentChars();
+
                 if (!getChar(&c))
                     return false;
 
@@ -1986,7 +1991,18 @@ TokenStream::getStringOrTemplateToken(int untilChar, Token** tp)
     // We need to detect any of these chars:  " or ', \n (or its
     // equivalents), \\, EOF.  Because we detect EOL sequences here and
     // put them back immediately, we can use getCharIgnoreEOL().
-    while ((c = getCharIgnoreEOL()) != untilChar) {
+    for (;;) {
+        // Append runs of chars needing no processing all at once.
+        const CharT* run = userbuf.addressOfNextRawChar();
+        userbuf.skipOrdinaryStringChars(untilChar);
+        if (!tokenbuf.append(run, userbuf.addressOfNextRawChar())) {
+            ReportOutOfMemory(cx);
+            return false;
+        }
+
+        if ((c = getCharIgnoreEOL()) == untilChar)
+            break;
+
         if (c == EOF) {
             ungetCharIgnoreEOL(c);
             error(JSMSG_UNTERMINATED_STRING);
@@ -1030,6 +1030,51 @@ class MOZ_STACK_CLASS TokenStream final : public TokenStreamAnyChars
         // have been scanned (*including* the char at startOffset_).
         size_t findEOLMax(size_t start, size_t max);
 
+        // The following skip over runs of raw chars which the scanner would
+        // otherwise examine one at a time through getChar() and friends. They
+        // never skip an EOL char, so line info is unaffected, and stop at the
+        // end of the buffer.
+
+        // Skip ASCII identifier chars, which need none of the surrogate and
+        // escape handling required for other identifier chars.
+        void skipAsciiIdentifierChars() {
+            MOZ_ASSERT(ptr);
+            while (ptr < limit_ && *ptr < 128 && js_isident[*ptr])
+                ptr++;
+        }
+
+        // Skip the rest of a single-line comment.
+        void skipCharsUntilEOL() {
+            MOZ_ASSERT(ptr);
+            while (ptr < limit_ && !isRawEOLChar(*ptr))
+                ptr++;
+        }
+
+        // Skip chars in a multi-line comment which can neither end the comment
+        // nor start a directive.
+        void skipOrdinaryBlockCommentChars() {
+            MOZ_ASSERT(ptr);
+            while (ptr < limit_) {
+                CharT c = *ptr;
+                if (c == '*' || c == '@' || c == '#' || isRawEOLChar(c))
+                    break;
+                ptr++;
+            }
+        }
+
+        // Skip chars in a string or template literal which are not the
+        // closing quote and need no escape, line terminator or substitution
+        // processing.
+        void skipOrdinaryStringChars(int untilChar) {
+            MOZ_ASSERT(ptr);
+            while (ptr < limit_) {
+                CharT c = *ptr;
+                if (c == untilChar || c == '\\' || c == '$' || isRawEOLChar(c))
+                    break;
+                ptr++;
+            }
+        }
+
       private:
         const CharT* base_;          // base of buffer
         uint32_t startOffset_;          // offset of base_[0]
@@ -145,9 +145,15 @@ struct TenureCount
 // Keep rough track of how many times we tenure objects in particular groups
 // during minor collections, using a fixed size hash for efficiency at the cost
 // of potential collisions.
+//
+// Colliding groups compete for an entry: a tenuring from a different group
+// decrements the current count and takes over the entry when it reaches zero.
+// This keeps the groups that are tenured most often (usually a handful of hot
+// allocation sites) in the cache even if a rarely tenured group got there
+// first.
 struct TenureCountCache
 {
-    static const size_t EntryShift = 4;
+    static const size_t EntryShift = 6;
     static const size_t EntryCount = 1 << EntryShift;
 
     TenureCount entries[EntryCount];
@@ -170,6 +176,16 @@ struct TenureCountCache
     TenureCount& findEntry(ObjectGroup* group) {
         return entries[hash(group) % EntryCount];
     }
+
+    void noteTenured(ObjectGroup* group) {
+        TenureCount& entry = findEntry(group);
+        if (entry.group == group) {
+            entry.count++;
+        } else if (!entry.group || --entry.count == 0) {
+            entry.group = group;
+            entry.count = 1;
+        }
+    }
 };
 
 } /* namespace gc */
@@ -245,6 +245,20 @@ class GCSchedulingTunables
     UnprotectedData<uint32_t> minEmptyChunkCount_;
     UnprotectedData<uint32_t> maxEmptyChunkCount_;
 
+    /*
+     * JSGC_MIN_FREE_COMMITTED_ARENAS
+     *
+     * The number of free arenas that background decommit leaves committed.
+     */
+    UnprotectedData<uint32_t> minFreeCommittedArenas_;
+
+    /*
+     * JSGC_HIGH_FREQUENCY_DECOMMIT_ENABLED
+     *
+     * Controls whether we decommit free arenas in high-frequency GC mode.
+     */
+    ActiveThreadData<bool> highFrequencyDecommitEnabled_;
+
   public:
     GCSchedulingTunables();
 
@@ -265,6 +279,8 @@ class GCSchedulingTunables
     bool areRefreshFrameSlicesEnabled() const { return refreshFrameSlicesEnabled_; }
     unsigned minEmptyChunkCount(const AutoLockGC&) const { return minEmptyChunkCount_; }
     unsigned maxEmptyChunkCount() const { return maxEmptyChunkCount_; }
+    uint32_t minFreeCommittedArenas() const { return minFreeCommittedArenas_; }
+    bool isHighFrequencyDecommitEnabled() const { return highFrequencyDecommitEnabled_; }
 
     MOZ_MUST_USE bool setParameter(JSGCParamKey key, uint32_t value, const AutoLockGC& lock);
     void resetParameter(JSGCParamKey key, const AutoLockGC& lock);
@@ -1068,8 +1084,8 @@ class GCRuntime
     IncrementalProgress sweepWeakCaches(SliceBudget& budget);
     static IncrementalProgress finalizeAllocKind(GCRuntime* gc, FreeOp* fop, SliceBudget& budget,
                                                  Zone* zone, AllocKind kind);
-    static IncrementalProgress sweepShapeTree(GCRuntime* gc, FreeOp* fop, SliceBudget& budget,
-                                              Zone* zone);
+    static IncrementalProgress sweepShapeTree(GCRuntime* gc, FreeOp* fop, SliceBudget& budget);
+    IncrementalProgress sweepShapeTree(SliceBudget& budget);
     void endSweepPhase(bool lastGC, AutoLockForExclusiveAccess& lock);
     bool allCCVisibleZonesWereCollected() const;
     void sweepZones(FreeOp* fop, ZoneGroup* group, bool lastGC);
@@ -85,7 +85,7 @@ js::gc::InitTrace(GCRuntime& gc)
     if (!filename)
         return true;
 
-    if (!tracedClasses.init() || !tracedTypes.init()) {
+    if (!tracedClasses.init() || !tracedGroups.init()) {
         FinishTrace();
         return false;
     }
@@ -113,7 +113,7 @@ js::gc::FinishTrace()
         gcTraceFile = nullptr;
     }
     tracedClasses.finish();
-    tracedTypes.finish();
+    tracedGroups.finish();
 }
 
 bool
@@ -161,7 +161,7 @@ MaybeTraceGroup(ObjectGroup* group)
         return;
 
     MaybeTraceClass(group->clasp());
-    TraceEvent(TraceEventGroupInfo, uint64_t(group));
+    TraceEvent(TraceEventTypeInfo, uint64_t(group));
     TraceAddress(group->clasp());
     TraceInt(group->flags());
 
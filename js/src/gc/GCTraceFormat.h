@@ -40,7 +40,7 @@ enum GCTraceEvent {
     GCTraceEventCount
 };
 
-const unsigned TraceFormatVersion = 1;
+const unsigned TraceFormatVersion = 2;
 
 const unsigned TracePayloadBits = 48;
 
@@ -50,7 +50,7 @@ const unsigned TraceExtraBits = 8;
 const unsigned TraceEventShift = 56;
 const unsigned TraceEventBits = 8;
 
-const unsigned AllocKinds = 22;
-const unsigned LastObjectAllocKind = 11;
+const unsigned AllocKinds = 29;
+const unsigned LastObjectAllocKind = 13;
 
 #endif
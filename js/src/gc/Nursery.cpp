@@ -364,6 +364,22 @@ js::Nursery::reallocateBuffer(JSObject* obj, void* oldBuffer,
     if (newBytes < oldBytes)
         return oldBuffer;
 
+    /*
+     * If this was the most recent nursery allocation and there is room left
+     * in the current chunk, grow the buffer in place by bumping the
+     * allocation pointer rather than copying it to a new buffer.
+     */
+    size_t extraBytes = newBytes - oldBytes;
+    if (newBytes <= MaxNurseryBufferSize &&
+        extraBytes % CellAlignBytes == 0 &&
+        uintptr_t(oldBuffer) + oldBytes == position() &&
+        position() + extraBytes <= currentEnd())
+    {
+        JS_EXTRA_POISON((void*)position(), JS_ALLOCATED_NURSERY_PATTERN, extraBytes);
+        position_ = position() + extraBytes;
+        return oldBuffer;
+    }
+
     void* newBuffer = allocateBuffer(obj->zone(), newBytes);
     if (newBuffer)
         PodCopy((uint8_t*)newBuffer, (uint8_t*)oldBuffer, oldBytes);
@@ -560,6 +576,10 @@ js::Nursery::endProfile(ProfileKey key)
     totalDurations_[key] += profileDurations_[key];
 }
 
+// The number of objects in a group that must be tenured by a single minor GC
+// before we consider pretenuring the group.
+static const int PretenureGroupThreshold = 3000;
+
 static inline bool
 IsFullStoreBufferReason(JS::gcreason::Reason reason)
 {
@@ -628,7 +648,7 @@ js::Nursery::collect(JS::gcreason::Reason reason)
     if (promotionRate > 0.8 || IsFullStoreBufferReason(reason)) {
         JSContext* cx = TlsContext.get();
         for (auto& entry : tenureCounts.entries) {
-            if (entry.count >= 3000) {
+            if (entry.count >= PretenureGroupThreshold) {
                 ObjectGroup* group = entry.group;
                 if (group->canPreTenure()) {
                     AutoCompartment ac(cx, group);
@@ -677,7 +697,8 @@ js::Nursery::collect(JS::gcreason::Reason reason)
         if (reportTenurings_) {
             for (auto& entry : tenureCounts.entries) {
                 if (entry.count >= reportTenurings_) {
-                    fprintf(stderr, "  %d x ", entry.count);
+                    fprintf(stderr, "  %d x%s ", entry.count,
+                            entry.group->shouldPreTenure() ? " (pretenured)" : "");
                     entry.group->print();
                 }
             }
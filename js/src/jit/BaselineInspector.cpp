@@ -612,6 +612,24 @@ BaselineInspector::getSingleCallee(jsbytecode* pc)
     return stub->toCall_Scripted()->callee();
 }
 
+bool
+BaselineInspector::isMonomorphicScriptedCall(jsbytecode* pc)
+{
+    if (!hasBaselineScript())
+        return false;
+
+    // Accessors are also inlined through call sites without a Call IC.
+    const BaselineICEntry* entry = maybeICEntryFromPC(pc);
+    if (!entry || !entry->fallbackStub()->isCall_Fallback())
+        return false;
+
+    if (entry->fallbackStub()->toCall_Fallback()->hadUnoptimizableCall())
+        return false;
+
+    ICStub* stub = entry->firstStub();
+    return stub->isCall_Scripted() && stub->next() == entry->fallbackStub();
+}
+
 JSObject*
 BaselineInspector::getTemplateObjectForNative(jsbytecode* pc, Native native)
 {
@@ -134,6 +134,7 @@ class BaselineInspector
     ObjectGroup* getTemplateObjectGroup(jsbytecode* pc);
 
     JSFunction* getSingleCallee(jsbytecode* pc);
+    bool isMonomorphicScriptedCall(jsbytecode* pc);
 
     LexicalEnvironmentObject* templateNamedLambdaObject();
     CallObject* templateCallObject();
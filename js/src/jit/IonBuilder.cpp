@@ -152,6 +152,7 @@ IonBuilder::IonBuilder(JSContext* analysisContext, CompileCompartment* comp,
     inspector(inspector),
     inliningDepth_(inliningDepth),
     inlinedBytecodeLength_(0),
+    hotInlinedBytecodeLength_(0),
     numLoopRestarts_(0),
     failedBoundsCheck_(info->script()->failedBoundsCheck()),
     failedShapeGuard_(info->script()->failedShapeGuard()),
@@ -3998,12 +3999,22 @@ IonBuilder::makeInliningDecision(JSObject* targetArg, CallInfo& callInfo)
     // Heuristics!
     JSScript* targetScript = target->nonLazyScript();
 
+    // Hot call edges may exceed the callee and caller size limits below, as
+    // long as the compilation's budget for such edges is not exhausted.
+    bool hotEdge = isHotCallEdge(targetScript);
+    bool useHotBudget = false;
+
     // Callee must not be excessively large.
     // This heuristic also applies to the callsite as a whole.
     bool offThread = options.offThreadCompilationAvailable();
     if (targetScript->length() > optimizationInfo().inlineMaxBytecodePerCallSite(offThread)) {
-        trackOptimizationOutcome(TrackedOutcome::CantInlineBigCallee);
-        return DontInline(targetScript, "Vetoed: callee excessively large");
+        if (!hotEdge ||
+            targetScript->length() > optimizationInfo().inlineMaxBytecodePerHotCallSite())
+        {
+            trackOptimizationOutcome(TrackedOutcome::CantInlineBigCallee);
+            return DontInline(targetScript, "Vetoed: callee excessively large");
+        }
+        useHotBudget = true;
     }
 
     // Callee must have been called a few times to have somewhat stable
@@ -4047,8 +4058,20 @@ IonBuilder::makeInliningDecision(JSObject* targetArg, CallInfo& callInfo)
 
         // Caller must not be excessively large.
         if (script()->length() >= optimizationInfo().inliningMaxCallerBytecodeLength()) {
-            trackOptimizationOutcome(TrackedOutcome::CantInlineBigCaller);
-            return DontInline(targetScript, "Vetoed: caller excessively large");
+            if (!hotEdge) {
+                trackOptimizationOutcome(TrackedOutcome::CantInlineBigCaller);
+                return DontInline(targetScript, "Vetoed: caller excessively large");
+            }
+            useHotBudget = true;
+        }
+    }
+
+    if (useHotBudget) {
+        size_t totalHotBytecodeLength =
+            outerBuilder->hotInlinedBytecodeLength_ + targetScript->length();
+        if (totalHotBytecodeLength > optimizationInfo().inlineMaxTotalHotBytecodeLength()) {
+            trackOptimizationOutcome(TrackedOutcome::CantInlineExceededHotBytecodeLength);
+            return DontInline(targetScript, "Vetoed: exceeding max hot call edge bytecode length");
         }
     }
 
@@ -4098,9 +4121,39 @@ IonBuilder::makeInliningDecision(JSObject* targetArg, CallInfo& callInfo)
 
     outerBuilder->inlinedBytecodeLength_ += targetScript->length();
 
+    if (useHotBudget) {
+        outerBuilder->hotInlinedBytecodeLength_ += targetScript->length();
+        JitSpew(JitSpew_Inlining, "Inlining %s:%zu on hot call edge (%zu of %u hot bytes used)",
+                targetScript->filename(), targetScript->lineno(),
+                outerBuilder->hotInlinedBytecodeLength_,
+                optimizationInfo().inlineMaxTotalHotBytecodeLength());
+    }
+
     return InliningDecision_Inline;
 }
 
+bool
+IonBuilder::isHotCallEdge(JSScript* targetScript)
+{
+    // Rank call edges using the profile Baseline gathered for the outermost
+    // script: an edge is hot if it is in a loop, Baseline only ever saw this
+    // callee there, and the callee has run at least as often as the script
+    // being compiled. Such edges are where a missed inlining costs the most,
+    // because the call overhead and the loss of type information are paid on
+    // every iteration.
+    if (info().analysisMode() != Analysis_None)
+        return false;
+
+    if (loopDepth_ == 0)
+        return false;
+
+    if (!inspector->isMonomorphicScriptedCall(pc))
+        return false;
+
+    JSScript* outerScript = outermostBuilder()->script();
+    return targetScript->getWarmUpCount() >= outerScript->getWarmUpCount();
+}
+
 AbortReasonOr<Ok>
 IonBuilder::selectInliningTargets(const InliningTargets& targets, CallInfo& callInfo,
                                   BoolVector& choiceSet, uint32_t* numInlineable)
@@ -616,6 +616,7 @@ class IonBuilder
     // Oracles.
     InliningDecision canInlineTarget(JSFunction* target, CallInfo& callInfo);
     InliningDecision makeInliningDecision(JSObject* target, CallInfo& callInfo);
+    bool isHotCallEdge(JSScript* targetScript);
     AbortReasonOr<Ok> selectInliningTargets(const InliningTargets& targets, CallInfo& callInfo,
                                             BoolVector& choiceSet, uint32_t* numInlineable);
 
@@ -1058,9 +1059,11 @@ class IonBuilder
 
     size_t inliningDepth_;
 
-    // Total bytecode length of all inlined scripts. Only tracked for the
-    // outermost builder.
+    // Total bytecode length of all inlined scripts, and the part of it that
+    // was inlined on hot call edges beyond the normal size limits. Only
+    // tracked for the outermost builder.
     size_t inlinedBytecodeLength_;
+    size_t hotInlinedBytecodeLength_;
 
     // Cutoff to disable compilation if excessive time is spent reanalyzing
     // loop bodies to compute a fixpoint of the types for loop variables.
@@ -44,6 +44,8 @@ OptimizationInfo::initNormalOptimizationInfo()
     inlineMaxBytecodePerCallSiteHelperThread_ = 1100;
     inlineMaxCalleeInlinedBytecodeLength_ = 3550;
     inlineMaxTotalBytecodeLength_ = 85000;
+    inlineMaxBytecodePerHotCallSite_ = 2200;
+    inlineMaxTotalHotBytecodeLength_ = 6000;
     inliningMaxCallerBytecodeLength_ = 1600;
     maxInlineDepth_ = 3;
     scalarReplacement_ = true;
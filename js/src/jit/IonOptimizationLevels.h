@@ -109,6 +109,12 @@ class OptimizationInfo
     // The maximum bytecode length we'll inline in a single compilation.
     uint32_t inlineMaxTotalBytecodeLength_;
 
+    // The maximum total bytecode size of an inline call site on a hot call
+    // edge, and the maximum bytecode length a single compilation may inline on
+    // such edges beyond the normal per call site and caller size limits.
+    uint32_t inlineMaxBytecodePerHotCallSite_;
+    uint32_t inlineMaxTotalHotBytecodeLength_;
+
     // The maximum bytecode length the caller may have,
     // before we stop inlining large functions in that caller.
     uint32_t inliningMaxCallerBytecodeLength_;
@@ -260,6 +266,14 @@ class OptimizationInfo
         return inlineMaxTotalBytecodeLength_;
     }
 
+    uint32_t inlineMaxBytecodePerHotCallSite() const {
+        return inlineMaxBytecodePerHotCallSite_;
+    }
+
+    uint32_t inlineMaxTotalHotBytecodeLength() const {
+        return inlineMaxTotalHotBytecodeLength_;
+    }
+
     uint32_t inliningMaxCallerBytecodeLength() const {
         return inliningMaxCallerBytecodeLength_;
     }
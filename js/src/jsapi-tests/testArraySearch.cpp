@@ -0,0 +1,264 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+ * vim: set ts=8 sts=4 et sw=4 tw=99:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "jsapi-tests/tests.h"
+
+/*
+ * Array.prototype.indexOf and includes search the dense elements of plain
+ * arrays natively. Check them against the self-hosted search, which is what
+ * a proxy receiver gets.
+ */
+
+static const char* const CompareDefinition =
+    "function compare(arr, x, from) {"
+    "    var p = new Proxy(arr, {});"
+    "    var args = from === undefined ? [x] : [x, from];"
+    "    var fast = Array.prototype.indexOf.apply(arr, args);"
+    "    var slow = Array.prototype.indexOf.apply(p, args);"
+    "    if (fast !== slow)"
+    "        throw new Error('indexOf(' + String(x) + ', ' + from + '): ' + fast + ' != ' + slow);"
+    "    fast = Array.prototype.includes.apply(arr, args);"
+    "    slow = Array.prototype.includes.apply(p, args);"
+    "    if (fast !== slow)"
+    "        throw new Error('includes(' + String(x) + ', ' + from + '): ' + fast + ' != ' + slow);"
+    "}"
+    "function assertEq(actual, expected) {"
+    "    if (!Object.is(actual, expected))"
+    "        throw new Error(actual + ' != ' + expected);"
+    "}";
+
+BEGIN_TEST(testArraySearch_holes)
+{
+    EXEC(CompareDefinition);
+
+    // Holes are skipped by indexOf and match undefined in includes.
+    EXEC("var a = [1, , 3];"
+         "assertEq(a.indexOf(undefined), -1);"
+         "assertEq(a.includes(undefined), true);"
+         "compare(a, undefined);"
+         "compare(a, undefined, 2);"
+         "compare(a, 3);");
+
+    // Holes filled by indexed properties on the prototype chain.
+    EXEC("Array.prototype[1] = 'proto';"
+         "var a = [0, , 2];"
+         "assertEq(a.indexOf('proto'), 1);"
+         "assertEq(a.includes('proto'), true);"
+         "assertEq(a.includes(undefined), false);"
+         "compare(a, 'proto');"
+         "compare(a, undefined);"
+         "delete Array.prototype[1];"
+         "Object.prototype[1] = 2;"
+         "assertEq(a.indexOf(2), 1);"
+         "compare(a, 2);"
+         "delete Object.prototype[1];"
+         "assertEq(a.indexOf(2), 2);"
+         "compare(a, 2);");
+
+    return true;
+}
+END_TEST(testArraySearch_holes)
+
+BEGIN_TEST(testArraySearch_numbers)
+{
+    EXEC(CompareDefinition);
+
+    EXEC("var a = [1, NaN, -0, 0.5, '1'];"
+         "assertEq(a.indexOf(NaN), -1);"
+         "assertEq(a.includes(NaN), true);"
+         "assertEq(a.indexOf(0), 2);"
+         "assertEq(a.indexOf(-0), 2);"
+         "assertEq(a.includes(+0), true);"
+         "assertEq(a.indexOf(1), 0);"
+         "assertEq(a.indexOf('1'), 4);"
+         "compare(a, NaN);"
+         "compare(a, 0);"
+         "compare(a, -0);"
+         "compare(a, 0.5);"
+         "compare(a, 1);"
+         "compare(a, '1');"
+         "compare(a, NaN, 2);"
+         "compare(a, 0, -2);");
+
+    // Int32 and double representations of the same number are equal.
+    EXEC("var a = [1.5 - 0.5, 2];"
+         "assertEq(a.indexOf(1), 0);"
+         "compare(a, 1);");
+
+    return true;
+}
+END_TEST(testArraySearch_numbers)
+
+BEGIN_TEST(testArraySearch_strings)
+{
+    EXEC(CompareDefinition);
+
+    // Elements and search strings that are ropes, long enough not to be
+    // inline strings.
+    EXEC("var prefix = 'a string that is too long to be inline, ';"
+         "var a = [];"
+         "for (var i = 0; i < 50; i++)"
+         "    a.push(prefix + i);"
+         "var x = prefix + 42;"
+         "assertEq(a.indexOf(x), 42);"
+         "assertEq(a.includes(x), true);"
+         "assertEq(a.indexOf(prefix + 50), -1);"
+         "compare(a, x);"
+         "compare(a, prefix + 50);"
+         "compare(a, prefix + 7, 8);"
+         "compare(['', 'ab'], '');");
+
+#ifdef JS_GC_ZEAL
+    // Collect as often as possible while ropes are flattened.
+    JS_SetGCZeal(cx, 2, 1);
+    EXEC("var b = [];"
+         "for (var i = 0; i < 20; i++)"
+         "    b.push(prefix + i);"
+         "assertEq(b.indexOf(prefix + 19), 19);"
+         "assertEq(b.includes(prefix + 20), false);");
+    JS_SetGCZeal(cx, 0, 0);
+#endif
+
+    return true;
+}
+END_TEST(testArraySearch_strings)
+
+BEGIN_TEST(testArraySearch_length)
+{
+    EXEC(CompareDefinition);
+
+    // The length is past the initialized length of the elements.
+    EXEC("var a = [1, 2, 3];"
+         "a.length = 10;"
+         "assertEq(a.indexOf(1, 3), -1);"
+         "assertEq(a.indexOf(undefined, 3), -1);"
+         "assertEq(a.includes(undefined), true);"
+         "assertEq(a.includes(undefined, 3), true);"
+         "assertEq(a.includes(undefined, 9), true);"
+         "assertEq(a.includes(undefined, 10), false);"
+         "assertEq(a.includes(3, 5), false);"
+         "for (var from = -12; from <= 12; from++) {"
+         "    compare(a, undefined, from);"
+         "    compare(a, 3, from);"
+         "}"
+         "compare([], undefined);"
+         "compare([], undefined, 1);");
+
+    return true;
+}
+END_TEST(testArraySearch_length)
+
+BEGIN_TEST(testArraySearch_receivers)
+{
+    EXEC(CompareDefinition);
+
+    EXEC("var target = [1, , NaN, 'x'];"
+         "var p = new Proxy(target, {});"
+         "assertEq(Array.prototype.indexOf.call(p, 'x'), 3);"
+         "assertEq(Array.prototype.includes.call(p, NaN), true);"
+         "assertEq(Array.prototype.includes.call(p, undefined), true);");
+
+    EXEC("var ta = new Float64Array([1, NaN, -0]);"
+         "assertEq(Array.prototype.indexOf.call(ta, NaN), -1);"
+         "assertEq(Array.prototype.includes.call(ta, NaN), true);"
+         "assertEq(Array.prototype.indexOf.call(ta, 0), 2);"
+         "assertEq(Array.prototype.includes.call(ta, undefined), false);"
+         "var ia = new Int8Array(4);"
+         "assertEq(Array.prototype.indexOf.call(ia, 0, 2), 2);");
+
+    EXEC("var o = { length: 3, 0: 'a', 2: 'c' };"
+         "assertEq(Array.prototype.indexOf.call(o, 'c'), 2);"
+         "assertEq(Array.prototype.includes.call(o, undefined), true);");
+
+    return true;
+}
+END_TEST(testArraySearch_receivers)
+
+static const char* sInterruptScript;
+static bool sInterruptRan;
+
+static bool
+MutatingInterruptCallback(JSContext* cx)
+{
+    if (!sInterruptScript)
+        return true;
+
+    const char* bytes = sInterruptScript;
+    sInterruptScript = nullptr;
+    sInterruptRan = true;
+
+    JS::CompileOptions opts(cx);
+    JS::RootedValue rval(cx);
+    if (!JS::Evaluate(cx, opts, bytes, strlen(bytes), &rval))
+        return false;
+
+    JS_GC(cx);
+    return true;
+}
+
+static bool
+RequestMutatingInterrupt(JSContext* cx, unsigned argc, JS::Value* vp)
+{
+    JS::CallArgs args = JS::CallArgsFromVp(argc, vp);
+    JS_RequestInterruptCallback(cx);
+    args.rval().setUndefined();
+    return true;
+}
+
+BEGIN_TEST(testArraySearch_interrupt)
+{
+    CHECK(JS_AddInterruptCallback(cx, MutatingInterruptCallback));
+    CHECK(JS_DefineFunction(cx, global, "requestInterrupt", RequestMutatingInterrupt, 0, 0));
+    EXEC(CompareDefinition);
+
+    EXEC("var prefix = 'a string that is too long to be inline, ';"
+         "function makeArray() {"
+         "    var a = [];"
+         "    for (var i = 0; i < 100; i++)"
+         "        a.push(prefix + i);"
+         "    return a;"
+         "}");
+
+    // An interrupt callback that truncates the array during the search: the
+    // elements past the new length must not be read.
+    sInterruptScript = "arr.length = 0;";
+    sInterruptRan = false;
+    EXEC("var arr = makeArray();"
+         "requestInterrupt();"
+         "assertEq(arr.indexOf(prefix + 99), -1);");
+    CHECK(sInterruptRan);
+
+    sInterruptScript = "arr.length = 0;";
+    sInterruptRan = false;
+    EXEC("var arr = makeArray();"
+         "requestInterrupt();"
+         "assertEq(arr.includes(prefix + 99), false);");
+    CHECK(sInterruptRan);
+
+    // An interrupt callback that shrinks the array and adds an indexed
+    // property to the prototype chain: the search must see the property.
+    sInterruptScript = "arr.length = 10; Object.prototype[50] = prefix + 99;";
+    sInterruptRan = false;
+    EXEC("var arr = makeArray();"
+         "requestInterrupt();"
+         "assertEq(arr.indexOf(prefix + 99), 50);"
+         "delete Object.prototype[50];");
+    CHECK(sInterruptRan);
+
+    // An interrupt callback that grows the array.
+    sInterruptScript = "for (var i = 0; i < 1000; i++) arr.push(prefix + 'x');";
+    sInterruptRan = false;
+    EXEC("var arr = makeArray();"
+         "requestInterrupt();"
+         "assertEq(arr.indexOf(prefix + 99), 99);"
+         "assertEq(arr.indexOf(prefix + 'x'), 100);"
+         "compare(arr, prefix + 'x');");
+    CHECK(sInterruptRan);
+
+    return true;
+}
+END_TEST(testArraySearch_interrupt)
@@ -3,6 +3,7 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "jsapi-tests/tests.h"
+#include "vm/RegExpObject.h"
 
 BEGIN_TEST(testObjectIsRegExp)
 {
@@ -58,3 +59,90 @@ BEGIN_TEST(testGetRegExpSource)
     return true;
 }
 END_TEST(testGetRegExpSource)
+
+static bool
+RegExpHasJitCode(JSContext* cx, JS::HandleObject obj, bool* result)
+{
+    js::RegExpShared* shared = js::RegExpToShared(cx, obj);
+    if (!shared)
+        return false;
+    *result = shared->hasJitCode(js::RegExpShared::Normal, /* latin1 = */ true);
+    return true;
+}
+
+BEGIN_TEST(testRegExpTierUp)
+{
+    JS::RootedValue val(cx);
+    JS::RootedObject obj(cx);
+    bool hasJitCode;
+
+    // Short inputs are interpreted for the first executions.
+    EVAL("var re = /a+b/; re", &val);
+    obj = val.toObjectOrNull();
+    for (uint32_t i = 0; i < js::RegExpShared::ExecutionsBeforeJit; i++) {
+        EXEC("if (re.exec('xaab')[0] !== 'aab') throw 'wrong match';");
+        CHECK(RegExpHasJitCode(cx, obj, &hasJitCode));
+        CHECK(!hasJitCode);
+    }
+    EXEC("if (re.exec('xaab')[0] !== 'aab') throw 'wrong match';");
+    CHECK(RegExpHasJitCode(cx, obj, &hasJitCode));
+#ifdef JS_CODEGEN_NONE
+    CHECK(!hasJitCode);
+#else
+    CHECK(hasJitCode);
+#endif
+
+    // A long input tiers up on the first execution.
+    EVAL("var re2 = /c+d/; re2", &val);
+    obj = val.toObjectOrNull();
+    EXEC("var m = re2.exec('c'.repeat(5000) + 'd');"
+         "if (m[0].length !== 5001) throw 'wrong match';");
+    CHECK(RegExpHasJitCode(cx, obj, &hasJitCode));
+#ifdef JS_CODEGEN_NONE
+    CHECK(!hasJitCode);
+#else
+    CHECK(hasJitCode);
+#endif
+
+    // Short inputs keep using the JIT code once it exists.
+    EXEC("if (re2.exec('xcd')[0] !== 'cd') throw 'wrong match';");
+    CHECK(RegExpHasJitCode(cx, obj, &hasJitCode));
+#ifndef JS_CODEGEN_NONE
+    CHECK(hasJitCode);
+#endif
+
+    return true;
+}
+END_TEST(testRegExpTierUp)
+
+BEGIN_TEST(testRegExpTierUpUnavailable)
+{
+    JS::RootedValue val(cx);
+    JS::RootedObject obj(cx);
+    bool hasJitCode;
+
+    JS::ContextOptions oldOptions = JS::ContextOptionsRef(cx);
+    JS::ContextOptionsRef(cx).setNativeRegExp(false);
+
+    // Once tiering up finds native code unavailable, the pattern stays on
+    // the bytecode it has and keeps matching correctly.
+    EVAL("var re = /e+f/; re", &val);
+    obj = val.toObjectOrNull();
+    EXEC("for (var i = 0; i < 20; i++) {"
+         "    if (re.exec('xeef')[0] !== 'eef') throw 'wrong match';"
+         "    if (re.exec('x' + 'e'.repeat(5000) + 'f').index !== 1) throw 'wrong match';"
+         "    if (re.exec('xxx') !== null) throw 'wrong match';"
+         "}");
+    CHECK(RegExpHasJitCode(cx, obj, &hasJitCode));
+    CHECK(!hasJitCode);
+
+    js::RegExpShared* shared = js::RegExpToShared(cx, obj);
+    CHECK(shared);
+    CHECK(shared->isJitUnavailable(js::RegExpShared::Normal, /* latin1 = */ true));
+    CHECK(shared->isCompiled(js::RegExpShared::Normal, /* latin1 = */ true,
+                             js::RegExpShared::ForceByteCode));
+
+    JS::ContextOptionsRef(cx) = oldOptions;
+    return true;
+}
+END_TEST(testRegExpTierUpUnavailable)
@@ -82,6 +82,47 @@ BEGIN_TEST(testStructuredClone_string)
 }
 END_TEST(testStructuredClone_string)
 
+BEGIN_TEST(testStructuredClone_denseArray)
+{
+    JS::RootedObject g1(cx, createGlobal());
+    JS::RootedObject g2(cx, createGlobal());
+    CHECK(g1);
+    CHECK(g2);
+
+    JS::RootedValue v1(cx);
+
+    {
+        JSAutoCompartment ac(cx, g1);
+        EVAL("var a = [1, 2.5, , 'four'];"
+             "a[6] = 7;"
+             "a.extra = 8;"
+             "a",
+             &v1);
+        CHECK(v1.isObject());
+    }
+
+    {
+        JSAutoCompartment ac(cx, g2);
+        JS::RootedValue v2(cx);
+
+        CHECK(JS_StructuredClone(cx, v1, &v2, nullptr, nullptr));
+        CHECK(v2.isObject());
+        CHECK(&v1.toObject() != &v2.toObject());
+
+        CHECK(JS_SetProperty(cx, g2, "b", v2));
+
+        JS::RootedValue result(cx);
+        EVAL("Array.isArray(b) && b.length === 7 && b[0] === 1 && "
+             "b[1] === 2.5 && !(2 in b) && b[3] === 'four' && "
+             "!(4 in b) && !(5 in b) && b[6] === 7 && b.extra === 8",
+             &result);
+        CHECK(result.isTrue());
+    }
+
+    return true;
+}
+END_TEST(testStructuredClone_denseArray)
+
 struct StructuredCloneTestPrincipals final : public JSPrincipals {
     uint32_t rank;
 
@@ -1998,6 +1998,25 @@ typedef enum JSGCParamKey {
      * Pref: None
      */
     JSGC_ALLOCATION_THRESHOLD_FACTOR_AVOID_INTERRUPT = 26,
+
+    /**
+     * Background decommit leaves this many free arenas committed across all
+     * chunks so that allocation can reuse them without faulting in new pages.
+     *
+     * Pref: javascript.options.mem.gc_min_free_committed_arenas
+     * Default: MinFreeCommittedArenas
+     */
+    JSGC_MIN_FREE_COMMITTED_ARENAS = 27,
+
+    /**
+     * Whether free arenas are decommitted after a GC even when we are in
+     * high-frequency GC mode. This trades mutator time for lower memory use
+     * on memory-constrained devices.
+     *
+     * Pref: javascript.options.mem.gc_high_frequency_decommit
+     * Default: HighFrequencyDecommitEnabled
+     */
+    JSGC_HIGH_FREQUENCY_DECOMMIT_ENABLED = 28,
 } JSGCParamKey;
 
 extern JS_PUBLIC_API(void)
@@ -22,6 +22,7 @@
 #include "jsiter.h"
 #include "jsnum.h"
 #include "jsobj.h"
+#include "jsstr.h"
 #include "jstypes.h"
 #include "jsutil.h"
 
@@ -2273,6 +2274,218 @@ js::intrinsic_ArrayNativeSort(JSContext* cx, unsigned argc, Value* vp)
     return true;
 }
 
+enum class ArraySearchKind
+{
+    // Array.prototype.indexOf: strict equality, holes are skipped.
+    StrictEquality,
+
+    // Array.prototype.includes: SameValueZero, holes are undefined.
+    SameValueZero
+};
+
+/*
+ * Search the dense elements of |obj| in the range [start, end) for
+ * |searchElement|, which must not be a string. Strict equality and
+ * SameValueZero only differ from comparing the Value bits for numbers, so all
+ * other values are found with a simple scan over the elements.
+ */
+template <ArraySearchKind Kind>
+static bool
+SearchDenseElementsForNonString(NativeObject* obj, const Value& searchElement,
+                                uint32_t start, uint32_t end, uint32_t* index)
+{
+    MOZ_ASSERT(!searchElement.isString());
+    MOZ_ASSERT(end <= obj->getDenseInitializedLength());
+
+    const Value* elements = obj->getDenseElements();
+
+    if (searchElement.isNumber()) {
+        double d = searchElement.toNumber();
+        bool matchNaN = Kind == ArraySearchKind::SameValueZero && IsNaN(d);
+        for (uint32_t i = start; i < end; i++) {
+            const Value& elem = elements[i];
+            if (!elem.isNumber())
+                continue;
+            double e = elem.toNumber();
+            if (e == d || (matchNaN && IsNaN(e))) {
+                *index = i;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool matchHoles = Kind == ArraySearchKind::SameValueZero && searchElement.isUndefined();
+    for (uint32_t i = start; i < end; i++) {
+        const Value& elem = elements[i];
+        if (elem == searchElement || (matchHoles && elem.isMagic(JS_ELEMENTS_HOLE))) {
+            *index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Search the dense elements of |obj| in the range [start, end) for
+ * |searchString|. Returns |false| in |*handled| if an interrupt callback
+ * changed |obj| in a way the range doesn't account for, in which case the
+ * self-hosted code must perform the search.
+ */
+static bool
+SearchDenseElementsForString(JSContext* cx, HandleNativeObject obj, HandleString searchString,
+                             uint32_t start, uint32_t end, bool* handled, bool* found,
+                             uint32_t* index)
+{
+    uint32_t initLength = obj->getDenseInitializedLength();
+    MOZ_ASSERT(end <= initLength);
+
+    *handled = true;
+    *found = false;
+    for (uint32_t i = start; i < end; i++) {
+        if (!CheckForInterrupt(cx))
+            return false;
+
+        // Interrupt callbacks can run script, which may have shrunk the
+        // elements or added indexed properties to the object or its prototype
+        // chain. Comparing strings has no side effects, so the self-hosted
+        // code can redo the search from the start and get the same result as
+        // if the callback had run before it.
+        if (obj->getDenseInitializedLength() != initLength ||
+            ObjectMayHaveExtraIndexedProperties(obj))
+        {
+            *handled = false;
+            return true;
+        }
+
+        // Comparing strings may flatten ropes and trigger a GC, so don't hold
+        // on to the elements pointer.
+        const Value& elem = obj->getDenseElement(i);
+        if (!elem.isString())
+            continue;
+
+        bool equal;
+        if (!EqualStrings(cx, elem.toString(), searchString, &equal))
+            return false;
+        if (equal) {
+            *found = true;
+            *index = i;
+            return true;
+        }
+    }
+    return true;
+}
+
+/*
+ * Shared implementation of ArrayNativeIndexOf and ArrayNativeIncludes. Returns
+ * |false| in |*handled| if the receiver may have indexed properties besides
+ * its dense elements and the self-hosted code must perform the search.
+ */
+template <ArraySearchKind Kind>
+static bool
+ArrayNativeSearch(JSContext* cx, const CallArgs& args, bool* handled, bool* found,
+                  double* index)
+{
+    MOZ_ASSERT(args.length() == 3);
+    MOZ_ASSERT(args[1].isNumber());
+    MOZ_ASSERT(args[2].isNumber());
+
+    *handled = false;
+    *found = false;
+
+    JSObject* thisObj = &args.thisv().toObject();
+    if (!thisObj->isNative() || ObjectMayHaveExtraIndexedProperties(thisObj))
+        return true;
+
+    RootedNativeObject obj(cx, &thisObj->as<NativeObject>());
+    HandleValue searchElement = args[0];
+    double start = args[1].toNumber();
+    double len = args[2].toNumber();
+    MOZ_ASSERT(start >= 0);
+
+    *handled = true;
+
+    // There are no indexed properties besides the dense elements, so indices
+    // past the initialized length are holes.
+    uint32_t initLength = obj->getDenseInitializedLength();
+    uint32_t end = uint32_t(Min(len, double(initLength)));
+    uint32_t first = uint32_t(Min(start, double(end)));
+
+    uint32_t i;
+    if (searchElement.isString()) {
+        RootedString searchString(cx, searchElement.toString());
+        if (!SearchDenseElementsForString(cx, obj, searchString, first, end, handled, found,
+                                          &i))
+        {
+            return false;
+        }
+        if (!*handled)
+            return true;
+    } else {
+        *found = SearchDenseElementsForNonString<Kind>(obj, searchElement, first, end, &i);
+    }
+
+    if (*found) {
+        *index = i;
+        return true;
+    }
+
+    // Holes after the initialized length are undefined for includes.
+    if (Kind == ArraySearchKind::SameValueZero && searchElement.isUndefined()) {
+        double hole = Max(start, double(initLength));
+        if (hole < len) {
+            *found = true;
+            *index = hole;
+        }
+    }
+
+    return true;
+}
+
+bool
+js::intrinsic_ArrayNativeIndexOf(JSContext* cx, unsigned argc, Value* vp)
+{
+    // This function is called from the self-hosted Array.prototype.indexOf
+    // implementation with the search element, the start index and the length.
+    // It returns the index of the first match or -1, or |undefined| to notify
+    // the self-hosted code to perform the search.
+    CallArgs args = CallArgsFromVp(argc, vp);
+
+    bool handled, found;
+    double index;
+    if (!ArrayNativeSearch<ArraySearchKind::StrictEquality>(cx, args, &handled, &found, &index))
+        return false;
+
+    if (!handled)
+        args.rval().setUndefined();
+    else if (found)
+        args.rval().setNumber(index);
+    else
+        args.rval().setInt32(-1);
+    return true;
+}
+
+bool
+js::intrinsic_ArrayNativeIncludes(JSContext* cx, unsigned argc, Value* vp)
+{
+    // This function is called from the self-hosted Array.prototype.includes
+    // implementation with the search element, the start index and the length.
+    // It returns whether the element was found, or |undefined| to notify the
+    // self-hosted code to perform the search.
+    CallArgs args = CallArgsFromVp(argc, vp);
+
+    bool handled, found;
+    double index;
+    if (!ArrayNativeSearch<ArraySearchKind::SameValueZero>(cx, args, &handled, &found, &index))
+        return false;
+
+    if (!handled)
+        args.rval().setUndefined();
+    else
+        args.rval().setBoolean(found);
+    return true;
+}
+
 bool
 js::NewbornArrayPush(JSContext* cx, HandleObject obj, const Value& v)
 {
@@ -160,6 +160,12 @@ GetElements(JSContext* cx, HandleObject aobj, uint32_t length, js::Value* vp);
 extern bool
 intrinsic_ArrayNativeSort(JSContext* cx, unsigned argc, js::Value* vp);
 
+extern bool
+intrinsic_ArrayNativeIndexOf(JSContext* cx, unsigned argc, js::Value* vp);
+
+extern bool
+intrinsic_ArrayNativeIncludes(JSContext* cx, unsigned argc, js::Value* vp);
+
 extern bool
 array_push(JSContext* cx, unsigned argc, js::Value* vp);
 
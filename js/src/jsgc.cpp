@@ -321,6 +321,12 @@ namespace TuningDefaults {
     /* JSGC_MAX_EMPTY_CHUNK_COUNT */
     static const uint32_t MaxEmptyChunkCount = 30;
 
+    /* JSGC_MIN_FREE_COMMITTED_ARENAS */
+    static const uint32_t MinFreeCommittedArenas = 0;
+
+    /* JSGC_HIGH_FREQUENCY_DECOMMIT_ENABLED */
+    static const bool HighFrequencyDecommitEnabled = false;
+
     /* JSGC_SLICE_TIME_BUDGET */
     static const int64_t DefaultTimeBudget =
         SliceBudget::UnlimitedTimeBudget;
@@ -1369,6 +1375,12 @@ GCSchedulingTunables::setParameter(JSGCParamKey key, uint32_t value, const AutoL
       case JSGC_REFRESH_FRAME_SLICES_ENABLED:
         refreshFrameSlicesEnabled_ = value != 0;
         break;
+      case JSGC_MIN_FREE_COMMITTED_ARENAS:
+        minFreeCommittedArenas_ = value;
+        break;
+      case JSGC_HIGH_FREQUENCY_DECOMMIT_ENABLED:
+        highFrequencyDecommitEnabled_ = value != 0;
+        break;
       default:
         MOZ_CRASH("Unknown GC parameter.");
     }
@@ -1430,7 +1442,9 @@ GCSchedulingTunables::GCSchedulingTunables()
     dynamicMarkSliceEnabled_(TuningDefaults::DynamicMarkSliceEnabled),
     refreshFrameSlicesEnabled_(TuningDefaults::RefreshFrameSlicesEnabled),
     minEmptyChunkCount_(TuningDefaults::MinEmptyChunkCount),
-    maxEmptyChunkCount_(TuningDefaults::MaxEmptyChunkCount)
+    maxEmptyChunkCount_(TuningDefaults::MaxEmptyChunkCount),
+    minFreeCommittedArenas_(TuningDefaults::MinFreeCommittedArenas),
+    highFrequencyDecommitEnabled_(TuningDefaults::HighFrequencyDecommitEnabled)
 {}
 
 void
@@ -1522,6 +1536,12 @@ GCSchedulingTunables::resetParameter(JSGCParamKey key, const AutoLockGC& lock)
       case JSGC_REFRESH_FRAME_SLICES_ENABLED:
         refreshFrameSlicesEnabled_ = TuningDefaults::RefreshFrameSlicesEnabled;
         break;
+      case JSGC_MIN_FREE_COMMITTED_ARENAS:
+        minFreeCommittedArenas_ = TuningDefaults::MinFreeCommittedArenas;
+        break;
+      case JSGC_HIGH_FREQUENCY_DECOMMIT_ENABLED:
+        highFrequencyDecommitEnabled_ = TuningDefaults::HighFrequencyDecommitEnabled;
+        break;
       default:
         MOZ_CRASH("Unknown GC parameter.");
     }
@@ -1585,6 +1605,10 @@ GCRuntime::getParameter(JSGCParamKey key, const AutoLockGC& lock)
         return compactingEnabled;
       case JSGC_REFRESH_FRAME_SLICES_ENABLED:
         return tunables.areRefreshFrameSlicesEnabled();
+      case JSGC_MIN_FREE_COMMITTED_ARENAS:
+        return tunables.minFreeCommittedArenas();
+      case JSGC_HIGH_FREQUENCY_DECOMMIT_ENABLED:
+        return tunables.isHighFrequencyDecommitEnabled();
       default:
         MOZ_ASSERT(key == JSGC_NUMBER);
         return uint32_t(number);
@@ -2646,12 +2670,23 @@ GCRuntime::updateCellPointers(MovingTracer* trc, Zone* zone, AllocKinds kinds, s
         for (size_t i = 0; i < bgTaskCount && !bgArenas.done(); i++) {
             bgTasks[i].emplace(rt, &bgArenas, lock);
             startTask(*bgTasks[i], gcstats::PhaseKind::COMPACT_UPDATE_CELLS, lock);
-            tasksStarted = i;
+            tasksStarted = i + 1;
         }
     }
 
     fgTask->runFromActiveCooperatingThread(rt);
 
+    // Rather than waiting for the background tasks to finish, help them
+    // update whatever arenas they have not yet claimed.
+    if (tasksStarted) {
+        Maybe<UpdatePointersTask> helpTask;
+        {
+            AutoLockHelperThreadState lock;
+            helpTask.emplace(rt, &bgArenas, lock);
+        }
+        helpTask->runFromActiveCooperatingThread(rt);
+    }
+
     {
         AutoLockHelperThreadState lock;
 
@@ -3321,8 +3356,9 @@ GCRuntime::startDecommit()
     MOZ_ASSERT(!decommitTask.isRunning());
 
     // If we are allocating heavily enough to trigger "high freqency" GC, then
-    // skip decommit so that we do not compete with the mutator.
-    if (schedulingState.inHighFrequencyGCMode())
+    // skip decommit so that we do not compete with the mutator, unless the
+    // embedding asked us to prefer lower memory use.
+    if (schedulingState.inHighFrequencyGCMode() && !tunables.isHighFrequencyDecommitEnabled())
         return;
 
     BackgroundDecommitTask::ChunkVector toDecommit;
@@ -3367,11 +3403,20 @@ js::gc::BackgroundDecommitTask::run()
 {
     AutoLockGC lock(runtime());
 
+    // Leave some free arenas committed if the embedding asked for it, so
+    // that we do not immediately fault their pages back in.
+    GCRuntime& gc = runtime()->gc;
+    uint32_t minFreeCommitted = gc.tunables.minFreeCommittedArenas();
+
     for (Chunk* chunk : toDecommit.ref()) {
+        if (gc.numArenasFreeCommitted <= minFreeCommitted)
+            break;
 
         // The arena list is not doubly-linked, so we have to work in the free
         // list order and not in the natural order.
-        while (chunk->info.numArenasFreeCommitted) {
+        while (chunk->info.numArenasFreeCommitted &&
+               gc.numArenasFreeCommitted > minFreeCommitted)
+        {
             bool ok = chunk->decommitOneFreeArena(runtime(), lock);
 
             // If we are low enough on memory that we can't update the page
@@ -4159,18 +4204,75 @@ PurgeShapeTablesForShrinkingGC(JSRuntime* rt)
     }
 }
 
-static void
-UnmarkCollectedZones(JSRuntime* rt)
+/*
+ * Hands out the zones being collected one at a time to the tasks that clear
+ * their mark state. Each zone owns its arenas and weak maps, so different
+ * zones can be unmarked on different threads without synchronization.
+ */
+class UnmarkZonesIterator
 {
-    for (GCZonesIter zone(rt); !zone.done(); zone.next()) {
-        /* Unmark everything in the zones being collected. */
-        zone->arenas.unmarkAll();
+    GCZonesIter zones;
+
+  public:
+    explicit UnmarkZonesIterator(JSRuntime* rt) : zones(rt) {}
+
+    bool done(const AutoLockHelperThreadState& lock) const {
+        return zones.done();
     }
 
-    for (GCZonesIter zone(rt); !zone.done(); zone.next()) {
-        /* Unmark all weak maps in the zones being collected. */
-        WeakMapBase::unmarkZone(zone);
+    Zone* next(const AutoLockHelperThreadState& lock) {
+        if (zones.done())
+            return nullptr;
+
+        Zone* zone = zones.get();
+        zones.next();
+        return zone;
+    }
+};
+
+class UnmarkZonesTask : public GCParallelTask
+{
+    UnmarkZonesIterator& work_;
+    AutoLockHelperThreadState& lock_;
+
+  public:
+    UnmarkZonesTask(JSRuntime* rt, UnmarkZonesIterator& work, AutoLockHelperThreadState& lock)
+      : GCParallelTask(rt), work_(work), lock_(lock)
+    {
+        runtime()->gc.startTask(*this, gcstats::PhaseKind::UNMARK, lock_);
+    }
+
+    ~UnmarkZonesTask() {
+        runtime()->gc.joinTask(*this, gcstats::PhaseKind::UNMARK, lock_);
+    }
+
+  private:
+    Zone* getZoneToUnmark() {
+        AutoLockHelperThreadState lock;
+        return work_.next(lock);
     }
+
+    void run() override {
+        while (Zone* zone = getZoneToUnmark()) {
+            /* Unmark everything in the zone. */
+            zone->arenas.unmarkAll();
+
+            /* Unmark all weak maps in the zone. */
+            WeakMapBase::unmarkZone(zone);
+        }
+    }
+};
+
+static const size_t MaxUnmarkTasks = 8;
+
+static size_t
+UnmarkTaskCount()
+{
+    if (!CanUseExtraThreads())
+        return 1;
+
+    size_t targetTaskCount = HelperThreadState().cpuCount / 2;
+    return Min(Max(targetTaskCount, size_t(1)), MaxUnmarkTasks);
 }
 
 static void
@@ -4208,11 +4310,14 @@ GCRuntime::beginMarkPhase(JS::gcreason::Reason reason, AutoLockForExclusiveAcces
 
         /*
          * Clear all mark state for the zones we are collecting. This is linear
-         * in the size of the heap we are collecting and so can be slow. Do this
-         * in parallel with the rest of this block.
+         * in the size of the heap we are collecting and so can be slow. Split
+         * the zones between several tasks and do this in parallel with the
+         * rest of this block.
          */
-        AutoRunParallelTask
-            unmarkCollectedZones(rt, UnmarkCollectedZones, gcstats::PhaseKind::UNMARK, helperLock);
+        UnmarkZonesIterator unmarkWork(rt);
+        Maybe<UnmarkZonesTask> unmarkTasks[MaxUnmarkTasks];
+        for (size_t i = 0; !unmarkWork.done(helperLock) && i < UnmarkTaskCount(); i++)
+            unmarkTasks[i].emplace(rt, unmarkWork, helperLock);
 
         /*
          * Buffer gray roots for incremental collections. This is linear in the
@@ -5985,20 +6090,170 @@ GCRuntime::finalizeAllocKind(GCRuntime* gc, FreeOp* fop, SliceBudget& budget, Zo
     return Finished;
 }
 
+static bool
+HasShapeTreeToSweep(Zone* zone)
+{
+    ArenaLists& al = zone->arenas;
+    return al.gcShapeArenasToUpdate.ref() || al.gcAccessorShapeArenasToUpdate.ref();
+}
+
+/*
+ * Hands out the zones in the current sweep group whose shape trees still need
+ * sweeping. Shapes never have parents or children in another zone, so the
+ * shape trees of different zones can be swept on different threads. A new
+ * iterator is used for each slice, so a zone left part way through when the
+ * budget ran out is picked up again by the next slice.
+ */
+class SweepShapeTreeZonesIterator
+{
+    GCSweepGroupIter zones;
+
+  public:
+    explicit SweepShapeTreeZonesIterator(JSRuntime* rt) : zones(rt) {
+        settle();
+    }
+
+    bool empty(AutoLockHelperThreadState& lock) const {
+        return zones.done();
+    }
+
+    Zone* next(AutoLockHelperThreadState& lock) {
+        if (empty(lock))
+            return nullptr;
+
+        Zone* zone = zones.get();
+        zones.next();
+        settle();
+        return zone;
+    }
+
+  private:
+    void settle() {
+        while (!zones.done() && !HasShapeTreeToSweep(zones.get()))
+            zones.next();
+    }
+};
+
+// Like SweepArenaList, but for a slice budget that is shared with other
+// threads and so must only be touched with the helper thread lock held.
+template <typename T>
+static bool
+SweepShapeArenaListWithSharedBudget(Arena** arenasToSweep, SliceBudget& budget)
+{
+    while (Arena* arena = *arenasToSweep) {
+        for (ArenaCellIterUnderGC i(arena); !i.done(); i.next())
+            SweepThing(i.get<T>());
+
+        *arenasToSweep = arena->next;
+
+        AutoLockHelperThreadState lock;
+        budget.step(Arena::thingsPerArena(MapTypeToFinalizeKind<T>::kind));
+        if (budget.isOverBudget())
+            return false;
+    }
+
+    return true;
+}
+
+// Sweep shape trees of zones taken from |work| until there are none left or
+// the budget runs out. This is run both by helper threads and by the main
+// thread.
+static void
+SweepShapeTreeZones(SweepShapeTreeZonesIterator& work, SliceBudget& budget)
+{
+    for (;;) {
+        Zone* zone;
+        {
+            AutoLockHelperThreadState lock;
+            if (budget.isOverBudget())
+                return;
+            zone = work.next(lock);
+        }
+        if (!zone)
+            return;
+
+        ArenaLists& al = zone->arenas;
+        if (!SweepShapeArenaListWithSharedBudget<Shape>(&al.gcShapeArenasToUpdate.ref(), budget))
+            return;
+        if (!SweepShapeArenaListWithSharedBudget<AccessorShape>(
+                &al.gcAccessorShapeArenasToUpdate.ref(), budget))
+        {
+            return;
+        }
+    }
+}
+
+class IncrementalSweepShapeTreeTask : public GCParallelTask
+{
+    SweepShapeTreeZonesIterator& work_;
+    SliceBudget& budget_;
+    AutoLockHelperThreadState& lock_;
+
+  public:
+    IncrementalSweepShapeTreeTask(JSRuntime* rt, SweepShapeTreeZonesIterator& work,
+                                  SliceBudget& budget, AutoLockHelperThreadState& lock)
+      : GCParallelTask(rt), work_(work), budget_(budget), lock_(lock)
+    {
+        runtime()->gc.startTask(*this, gcstats::PhaseKind::SWEEP_SHAPE, lock_);
+    }
+
+    ~IncrementalSweepShapeTreeTask() {
+        runtime()->gc.joinTask(*this, gcstats::PhaseKind::SWEEP_SHAPE, lock_);
+    }
+
+  private:
+    void run() override {
+        SweepShapeTreeZones(work_, budget_);
+    }
+};
+
 /* static */ IncrementalProgress
-GCRuntime::sweepShapeTree(GCRuntime* gc, FreeOp* fop, SliceBudget& budget, Zone* zone)
+GCRuntime::sweepShapeTree(GCRuntime* gc, FreeOp* fop, SliceBudget& budget)
 {
     // Remove dead shapes from the shape tree, but don't finalize them yet.
+    return gc->sweepShapeTree(budget);
+}
 
-    gcstats::AutoPhase ap(gc->stats(), gcstats::PhaseKind::SWEEP_SHAPE);
+static const size_t MaxSweepShapeTreeTasks = 8;
 
-    ArenaLists& al = zone->arenas;
+static size_t
+SweepShapeTreeTaskCount()
+{
+    // The main thread takes a share of the work too.
+    if (!CanUseExtraThreads())
+        return 0;
 
-    if (!SweepArenaList<Shape>(&al.gcShapeArenasToUpdate.ref(), budget))
-        return NotFinished;
+    size_t targetTaskCount = HelperThreadState().cpuCount / 2;
+    return Min(targetTaskCount, MaxSweepShapeTreeTasks);
+}
 
-    if (!SweepArenaList<AccessorShape>(&al.gcAccessorShapeArenasToUpdate.ref(), budget))
-        return NotFinished;
+IncrementalProgress
+GCRuntime::sweepShapeTree(SliceBudget& budget)
+{
+    // Each helper task and the main thread take whole zones from the sweep
+    // group and sweep them until the work or the slice budget is exhausted.
+    {
+        SweepShapeTreeZonesIterator work(rt);
+
+        AutoLockHelperThreadState lock;
+
+        Maybe<IncrementalSweepShapeTreeTask> tasks[MaxSweepShapeTreeTasks];
+        for (size_t i = 0; !work.empty(lock) && i < SweepShapeTreeTaskCount(); i++)
+            tasks[i].emplace(rt, work, budget, lock);
+
+        {
+            AutoUnlockHelperThreadState unlock(lock);
+            gcstats::AutoPhase ap(stats(), gcstats::PhaseKind::SWEEP_SHAPE);
+            SweepShapeTreeZones(work, budget);
+        }
+
+        // Tasks are joined here, once they have run out of work or budget.
+    }
+
+    for (GCSweepGroupIter zone(rt); !zone.done(); zone.next()) {
+        if (HasShapeTreeToSweep(zone))
+            return NotFinished;
+    }
 
     return Finished;
 }
@@ -6256,8 +6511,7 @@ GCRuntime::initSweepActions()
         ForEachZoneInSweepGroup(rt,
             ForEachAllocKind(ForegroundNonObjectFinalizePhase.kinds,
                 Func(finalizeAllocKind))),
-        ForEachZoneInSweepGroup(rt,
-            Func(sweepShapeTree)));
+        Func(sweepShapeTree));
 
     return sweepActions != nullptr;
 }
@@ -663,8 +663,8 @@ class ArenaLists
 
     // Arena lists which have yet to be swept, but need additional foreground
     // processing before they are swept.
-    ZoneGroupData<Arena*> gcShapeArenasToUpdate;
-    ZoneGroupData<Arena*> gcAccessorShapeArenasToUpdate;
+    ZoneGroupOrGCTaskData<Arena*> gcShapeArenasToUpdate;
+    ZoneGroupOrGCTaskData<Arena*> gcAccessorShapeArenasToUpdate;
     ZoneGroupData<Arena*> gcScriptArenasToUpdate;
     ZoneGroupData<Arena*> gcObjectGroupArenasToUpdate;
 
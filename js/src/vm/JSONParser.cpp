@@ -106,6 +106,40 @@ JSONParserBase::errorReturn()
     return errorHandling == NoError;
 }
 
+/*
+ * Skip plain characters at the start of [p, end) a 64-bit word at a time,
+ * stopping at or before the first character that can't appear unescaped in a
+ * JSON string ('"', '\\' or a control character).  String bodies in large
+ * payloads are mostly long runs of plain characters.
+ */
+template <typename CharT>
+static MOZ_ALWAYS_INLINE const CharT*
+SkipUnescapedStringChars(const CharT* p, const CharT* end)
+{
+    // One lane per character, with the low bit (Ones) and the high bit (High)
+    // of every lane set.
+    const uint64_t Ones = uint64_t(-1) / ((uint64_t(1) << (8 * sizeof(CharT))) - 1);
+    const uint64_t High = Ones << (8 * sizeof(CharT) - 1);
+    const size_t Lanes = sizeof(uint64_t) / sizeof(CharT);
+
+    while (size_t(end - p) >= Lanes) {
+        uint64_t word;
+        memcpy(&word, p, sizeof(word));
+
+        // (x - Ones * n) & ~x & High is non-zero iff some lane of x is less
+        // than n; the XORs turn the quote and backslash lanes into zeros.
+        uint64_t quote = word ^ (Ones * '"');
+        uint64_t backslash = word ^ (Ones * '\\');
+        uint64_t special = ((word - Ones * 0x20) & ~word) |
+                           ((quote - Ones) & ~quote) |
+                           ((backslash - Ones) & ~backslash);
+        if (special & High)
+            break;
+        p += Lanes;
+    }
+    return p;
+}
+
 template <typename CharT>
 template <JSONParserBase::StringType ST>
 JSONParserBase::Token
@@ -129,6 +163,7 @@ JSONParser<CharT>::readString()
      * string directly from the source text.
      */
     CharPtr start = current;
+    current += SkipUnescapedStringChars(current.get(), end.get()) - current.get();
     for (; current < end; current++) {
         if (*current == '"') {
             size_t length = current - start;
@@ -231,6 +266,7 @@ JSONParser<CharT>::readString()
             return token(OOM);
 
         start = current;
+        current += SkipUnescapedStringChars(current.get(), end.get()) - current.get();
         for (; current < end; current++) {
             if (*current == '"' || *current == '\\' || *current <= 0x001F)
                 break;
@@ -1032,7 +1032,12 @@ RegExpShared::compile(JSContext* cx, MutableHandleRegExpShared re, HandleAtom pa
         compilation.jitCode = code.jitCode;
     } else if (code.byteCode) {
         MOZ_ASSERT(tables.empty(), "RegExpInterpreter does not use data tables");
-        compilation.byteCode = code.byteCode;
+        // Tiering up falls back to bytecode when native code can't be
+        // generated; keep the bytecode we already have in that case.
+        if (compilation.byteCode)
+            js_free(code.byteCode);
+        else
+            compilation.byteCode = code.byteCode;
     }
 
     return true;
@@ -1059,8 +1064,21 @@ RegExpShared::execute(JSContext* cx, MutableHandleRegExpShared re, HandleLinearS
     CompilationMode mode = matches ? Normal : MatchOnly;
 
     /* Compile the code at point-of-use. */
-    if (!compileIfNecessary(cx, re, input, mode, DontForceByteCode))
-        return RegExpRunStatus_Error;
+    bool latin1 = input->hasLatin1Chars();
+    if (re->compilation(mode, latin1).jitCode) {
+        // Already tiered up.
+    } else if (re->compilation(mode, latin1).executions < ExecutionsBeforeJit &&
+               input->length() < InputLengthForImmediateJit)
+    {
+        re->compilation(mode, latin1).executions++;
+        if (!compileIfNecessary(cx, re, input, mode, ForceByteCode))
+            return RegExpRunStatus_Error;
+    } else if (!re->compilation(mode, latin1).jitUnavailable) {
+        if (!compile(cx, re, input, mode, DontForceByteCode))
+            return RegExpRunStatus_Error;
+        if (!re->compilation(mode, latin1).jitCode)
+            re->compilation(mode, latin1).jitUnavailable = true;
+    }
 
     /*
      * Ensure sufficient memory for output vector.
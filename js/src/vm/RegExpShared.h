@@ -108,13 +108,31 @@ class RegExpShared : public gc::TenuredCell
         ReadBarriered<jit::JitCode*> jitCode;
         uint8_t* byteCode;
 
-        RegExpCompilation() : byteCode(nullptr) {}
+        // Number of interpreted executions, saturating at ExecutionsBeforeJit.
+        // Until then the pattern only runs in the bytecode interpreter, unless
+        // the input is long enough to tier up straight away.
+        uint32_t executions;
+
+        // Set when tiering up produced no JIT code (native regexps disabled or
+        // not possible for this pattern), so we don't keep recompiling.
+        bool jitUnavailable;
+
+        RegExpCompilation() : byteCode(nullptr), executions(0), jitUnavailable(false) {}
 
         bool compiled(ForceByteCodeEnum force = DontForceByteCode) const {
             return byteCode || (force == DontForceByteCode && jitCode);
         }
     };
 
+    // Most regexps on a page are executed only a handful of times, and for
+    // those a native compile costs more than it saves. Interpret the first
+    // few executions and JIT-compile only patterns that keep being used.
+    static const uint32_t ExecutionsBeforeJit = 4;
+
+    // A single match against a long input can run for longer than a native
+    // compile takes, so such inputs tier up on the first execution.
+    static const size_t InputLengthForImmediateJit = 1000;
+
     /* Source to the RegExp, for lazy compilation. */
     HeapPtr<JSAtom*>   source;
 
@@ -195,6 +213,12 @@ class RegExpShared : public gc::TenuredCell
         return isCompiled(Normal, true) || isCompiled(Normal, false)
             || isCompiled(MatchOnly, true) || isCompiled(MatchOnly, false);
     }
+    bool hasJitCode(CompilationMode mode, bool latin1) const {
+        return compilation(mode, latin1).jitCode.unbarrieredGet() != nullptr;
+    }
+    bool isJitUnavailable(CompilationMode mode, bool latin1) const {
+        return compilation(mode, latin1).jitUnavailable;
+    }
 
     void traceChildren(JSTracer* trc);
     void discardJitCode();
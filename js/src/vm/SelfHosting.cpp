@@ -2269,6 +2269,8 @@ static const JSFunctionSpec intrinsic_functions[] = {
     JS_FN("std_Array_reverse",                   array_reverse,                0,0),
     JS_FNINFO("std_Array_splice",                array_splice, &array_splice_info, 2,0),
     JS_FN("ArrayNativeSort",                     intrinsic_ArrayNativeSort,    1,0),
+    JS_FN("ArrayNativeIndexOf",                  intrinsic_ArrayNativeIndexOf, 3,0),
+    JS_FN("ArrayNativeIncludes",                 intrinsic_ArrayNativeIncludes, 3,0),
 
     JS_FN("std_Date_now",                        date_now,                     0,0),
     JS_FN("std_Date_valueOf",                    date_valueOf,                 0,0),
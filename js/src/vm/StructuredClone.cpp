@@ -1741,6 +1741,24 @@ JSStructuredCloneWriter::write(HandleValue v)
                   return false;
                 MOZ_ASSERT(JSID_IS_STRING(id) || JSID_IS_INT(id));
 
+                /*
+                 * Dense elements are always own data properties, so read them
+                 * straight out of the elements vector. This avoids a full
+                 * property lookup per element for plain arrays of numbers.
+                 */
+                if (JSID_IS_INT(id) && obj->isNative()) {
+                    NativeObject* nobj = &obj->as<NativeObject>();
+                    uint32_t index = uint32_t(JSID_TO_INT(id));
+                    if (index < nobj->getDenseInitializedLength() &&
+                        !nobj->getDenseElement(index).isMagic(JS_ELEMENTS_HOLE))
+                    {
+                        RootedValue val(context(), nobj->getDenseElement(index));
+                        if (!startWrite(key) || !startWrite(val))
+                            return false;
+                        continue;
+                    }
+                }
+
                 /*
                  * If obj still has an own property named id, write it out.
                  * The cost of re-checking could be avoided by using
@@ -608,8 +608,7 @@ class TypedArrayObjectTemplate : public TypedArrayObject
         if (buf) {
 #ifdef DEBUG
             Nursery& nursery = cx->nursery();
-            MOZ_ASSERT_IF(!nursery.isInside(buf) && !tarray->hasInlineElements(),
-                          tarray->isTenured());
+            MOZ_ASSERT_IF(tarray->isTenured(), !nursery.isInside(buf));
 #endif
             tarray->initPrivate(buf);
         } else {
@@ -649,26 +648,32 @@ class TypedArrayObjectTemplate : public TypedArrayObject
         allocKind = GetBackgroundAllocKind(allocKind);
         RootedObjectGroup group(cx, templateObj->group());
 
-        NewObjectKind newKind = TenuredObject;
+        // Allocate the object in the nursery when possible and put its
+        // out-of-line contents there too, as the JIT's inline allocation path
+        // does. The ArrayBuffer stays lazy and is only created if script asks
+        // for it; objectMoved() copies the contents out when tenuring.
+        RootedObject tmp(cx, NewObjectWithGroup<TypedArrayObject>(cx, group, allocKind,
+                                                                  GenericObject));
+        if (!tmp)
+            return nullptr;
+
+        TypedArrayObject* obj = &tmp->as<TypedArrayObject>();
 
-        ScopedJSFreePtr<void> buf;
+        void* buf = nullptr;
         if (!fitsInline && len > 0) {
-            buf = cx->zone()->pod_malloc<uint8_t>(nbytes);
+            // Round up to match the size objectMoved() allocates on tenuring.
+            nbytes = JS_ROUNDUP(nbytes, sizeof(Value));
+            buf = cx->nursery().allocateBuffer(obj, nbytes);
             if (!buf) {
                 ReportOutOfMemory(cx);
                 return nullptr;
             }
 
             memset(buf, 0, nbytes);
-         }
-
-        RootedObject tmp(cx, NewObjectWithGroup<TypedArrayObject>(cx, group, allocKind, newKind));
-        if (!tmp)
-            return nullptr;
+        }
 
-        TypedArrayObject* obj = &tmp->as<TypedArrayObject>();
         initTypedArraySlots(cx, obj, len);
-        initTypedArrayData(cx, obj, len, buf.forget(), allocKind);
+        initTypedArrayData(cx, obj, len, buf, allocKind);
 
         return obj;
     }
@@ -1643,10 +1643,11 @@ CallMethodHelper::InitializeDispatchParams()
     }
 
     // iterate through the params to clear flags (for safe cleanup later)
-    for (uint8_t i = 0; i < paramCount + wantsJSContext + wantsOptArgc; i++) {
-        nsXPTCVariant* dp = mDispatchParams.AppendElement();
-        dp->ClearFlags();
-        dp->val.p = nullptr;
+    const uint8_t dispatchCount = paramCount + wantsJSContext + wantsOptArgc;
+    nsXPTCVariant* params = mDispatchParams.AppendElements(dispatchCount);
+    for (uint8_t i = 0; i < dispatchCount; i++) {
+        params[i].ClearFlags();
+        params[i].val.p = nullptr;
     }
 
     // Fill in the JSContext argument
@@ -1683,6 +1684,38 @@ CallMethodHelper::ConvertIndependentParams(bool* foundDependentParam)
     return true;
 }
 
+// Convert the common cases of a plain 'in' arithmetic param whose JS value
+// already has the native representation, without going through
+// XPCConvert::JSData2Native. Returns false if the generic path is needed.
+static MOZ_ALWAYS_INLINE bool
+ConvertSimpleInParam(nsXPTCVariant* dp, uint8_t type_tag, const Value& v)
+{
+    switch (type_tag) {
+    case nsXPTType::T_I32:
+        if (!v.isInt32())
+            return false;
+        dp->val.i32 = v.toInt32();
+        return true;
+    case nsXPTType::T_U32:
+        if (!v.isInt32())
+            return false;
+        dp->val.u32 = uint32_t(v.toInt32());
+        return true;
+    case nsXPTType::T_DOUBLE:
+        if (!v.isNumber())
+            return false;
+        dp->val.d = v.toNumber();
+        return true;
+    case nsXPTType::T_BOOL:
+        if (!v.isBoolean())
+            return false;
+        dp->val.b = v.toBoolean();
+        return true;
+    default:
+        return false;
+    }
+}
+
 bool
 CallMethodHelper::ConvertIndependentParam(uint8_t i)
 {
@@ -1693,6 +1726,14 @@ CallMethodHelper::ConvertIndependentParam(uint8_t i)
     dp->type = type;
     MOZ_ASSERT(!paramInfo.IsShared(), "[shared] implies [noscript]!");
 
+    // Arithmetic 'in' params need no cleanup, indirection or out-param
+    // checks, so handle the already-typed values inline.
+    if (paramInfo.IsIn() && !paramInfo.IsOut() && i < mArgc &&
+        ConvertSimpleInParam(dp, type_tag, mArgv[i]))
+    {
+        return true;
+    }
+
     // String classes are always "in" - those that are marked "out" are converted
     // by the XPIDL compiler to "in+dipper". See the note above IsDipper() in
     // xptinfo.h.
@@ -180,17 +180,19 @@ nsPresArena::AddSizeOfExcludingThis(nsWindowSizes& aSizes) const
   size_t mallocSize = mPool.SizeOfExcludingThis(aSizes.mState.mMallocSizeOf);
 
   size_t totalSizeInFreeLists = 0;
+  size_t freeSize = 0;
   for (const FreeList* entry = mFreeLists;
        entry != ArrayEnd(mFreeLists);
        ++entry) {
     mallocSize += entry->SizeOfExcludingThis(aSizes.mState.mMallocSizeOf);
 
-    // Note that we're not measuring the size of the entries on the free
-    // list here.  The free list knows how many objects we've allocated
-    // ever (which includes any objects that may be on the FreeList's
-    // |mEntries| at this point) and we're using that to determine the
-    // total size of objects allocated with a given ID.
-    size_t totalSize = entry->mEntrySize * entry->mEntriesEverAllocated;
+    // The free list knows how many objects we've allocated ever, and those
+    // on |mEntries| are the ones that have been freed since.  Charge only the
+    // live ones to their type, and report the recycled space separately so
+    // that arenas which have shed a lot of frames are visible as such.
+    size_t entryFreeSize = entry->mEntrySize * entry->mEntries.Length();
+    size_t totalSize =
+      entry->mEntrySize * entry->mEntriesEverAllocated - entryFreeSize;
 
     switch (entry - mFreeLists) {
 #define FRAME_ID(classname, ...) \
@@ -223,8 +225,10 @@ nsPresArena::AddSizeOfExcludingThis(nsWindowSizes& aSizes) const
         continue;
     }
 
-    totalSizeInFreeLists += totalSize;
+    totalSizeInFreeLists += totalSize + entryFreeSize;
+    freeSize += entryFreeSize;
   }
 
+  aSizes.mLayoutArenaFreeListsSize += freeSize;
   aSizes.mLayoutPresShellSize += mallocSize - totalSizeInFreeLists;
 }
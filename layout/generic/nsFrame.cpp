@@ -74,6 +74,7 @@
 #include "nsContainerFrame.h"
 #include "nsBoxLayoutState.h"
 #include "nsBlockFrame.h"
+#include "nsGridContainerFrame.h"
 #include "nsDisplayList.h"
 #include "nsSVGIntegrationUtils.h"
 #include "nsSVGEffects.h"
@@ -4717,6 +4718,10 @@ nsFrame::MarkIntrinsicISizesDirty()
   if (GetStateBits() & NS_FRAME_FONT_INFLATION_FLOW_ROOT) {
     nsFontInflationData::MarkFontInflationDataTextDirty(this);
   }
+
+  if (IsFlexOrGridItem() && GetParent()->IsGridContainerFrame()) {
+    nsGridContainerFrame::MarkCachedGridMeasurementsDirty(this);
+  }
 }
 
 /* virtual */ nscoord
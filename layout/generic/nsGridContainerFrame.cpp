@@ -3441,7 +3441,68 @@ nsGridContainerFrame::Tracks::Initialize(
 }
 
 /**
- * Reflow aChild in the given aAvailableSize.
+ * The block-size a grid item got from a measuring reflow, cached on the item
+ * so that the repeated min/max-content contributions we need while sizing
+ * tracks don't each reflow it again.  It's only reused while the item isn't
+ * dirty and is measured under the same constraints as before; our
+ * MarkIntrinsicISizesDirty also discards it (like nsFlexContainerFrame does
+ * for its measuring reflows).
+ */
+class GridItemMeasurement
+{
+  // Members that are part of the cache key:
+  const LogicalSize mAvailableSize;
+  const LogicalSize mCBSize;
+  const nscoord mIMinSizeClamp;
+  const nscoord mBMinSizeClamp;
+
+  // Members that are part of the cache value:
+  const nscoord mBSize;
+
+public:
+  GridItemMeasurement(const LogicalSize& aAvailableSize,
+                      const LogicalSize& aCBSize,
+                      nscoord aIMinSizeClamp,
+                      nscoord aBMinSizeClamp,
+                      nscoord aBSize)
+    : mAvailableSize(aAvailableSize)
+    , mCBSize(aCBSize)
+    , mIMinSizeClamp(aIMinSizeClamp)
+    , mBMinSizeClamp(aBMinSizeClamp)
+    , mBSize(aBSize)
+  {}
+
+  bool IsValidFor(const LogicalSize& aAvailableSize,
+                  const LogicalSize& aCBSize,
+                  nscoord aIMinSizeClamp,
+                  nscoord aBMinSizeClamp) const
+  {
+    return mAvailableSize == aAvailableSize &&
+           mCBSize == aCBSize &&
+           mIMinSizeClamp == aIMinSizeClamp &&
+           mBMinSizeClamp == aBMinSizeClamp;
+  }
+
+  nscoord BSize() const { return mBSize; }
+};
+
+NS_DECLARE_FRAME_PROPERTY_DELETABLE(GridItemMeasurementProperty,
+                                    GridItemMeasurement)
+
+/* static */ void
+nsGridContainerFrame::MarkCachedGridMeasurementsDirty(nsIFrame* aItemFrame)
+{
+  MOZ_ASSERT(aItemFrame->IsFlexOrGridItem() &&
+             aItemFrame->GetParent()->IsGridContainerFrame(),
+             "should only be called on grid items");
+  aItemFrame->DeleteProperty(GridItemMeasurementProperty());
+}
+
+/**
+ * Reflow aChild in the given aAvailableSize.  If aAllowCachedResult is true
+ * the block-size from an earlier measuring reflow under the same constraints
+ * may be returned instead, in which case aChild isn't reflowed; callers that
+ * need the reflow's side effects (e.g. its baselines) must pass false.
  */
 static nscoord
 MeasuringReflow(nsIFrame*           aChild,
@@ -3450,8 +3511,21 @@ MeasuringReflow(nsIFrame*           aChild,
                 const LogicalSize&  aAvailableSize,
                 const LogicalSize&  aCBSize,
                 nscoord             aIMinSizeClamp = NS_MAXSIZE,
-                nscoord             aBMinSizeClamp = NS_MAXSIZE)
+                nscoord             aBMinSizeClamp = NS_MAXSIZE,
+                bool                aAllowCachedResult = false)
 {
+  if (aAllowCachedResult &&
+      !aChild->HasAnyStateBits(NS_FRAME_IS_DIRTY |
+                               NS_FRAME_HAS_DIRTY_CHILDREN)) {
+    if (const auto* cached =
+          aChild->GetProperty(GridItemMeasurementProperty())) {
+      if (cached->IsValidFor(aAvailableSize, aCBSize,
+                             aIMinSizeClamp, aBMinSizeClamp)) {
+        return cached->BSize();
+      }
+    }
+  }
+
   nsContainerFrame* parent = aChild->GetParent();
   nsPresContext* pc = aChild->PresContext();
   Maybe<ReflowInput> dummyParentState;
@@ -3505,6 +3579,10 @@ MeasuringReflow(nsIFrame*           aChild,
 #ifdef DEBUG
     parent->DeleteProperty(nsContainerFrame::DebugReflowingWithInfiniteISize());
 #endif
+  aChild->SetProperty(GridItemMeasurementProperty(),
+                      new GridItemMeasurement(aAvailableSize, aCBSize,
+                                              aIMinSizeClamp, aBMinSizeClamp,
+                                              childSize.BSize(wm)));
   return childSize.BSize(wm);
 }
 
@@ -3564,7 +3642,8 @@ ContentContribution(const GridItemInfo&       aGridItem,
     }
     LogicalSize availableSize(childWM, availISize, availBSize);
     size = ::MeasuringReflow(child, aState.mReflowInput, aRC, availableSize,
-                             cbSize, iMinSizeClamp, bMinSizeClamp);
+                             cbSize, iMinSizeClamp, bMinSizeClamp,
+                             /* aAllowCachedResult */ true);
     nsIFrame::IntrinsicISizeOffsetData offsets = child->IntrinsicBSizeOffsets();
     size += offsets.hMargin;
     auto percent = offsets.hPctMargin;
@@ -6402,6 +6481,9 @@ nsGridContainerFrame::MarkIntrinsicISizesDirty()
   mBaseline[0][1] = NS_INTRINSIC_WIDTH_UNKNOWN;
   mBaseline[1][0] = NS_INTRINSIC_WIDTH_UNKNOWN;
   mBaseline[1][1] = NS_INTRINSIC_WIDTH_UNKNOWN;
+  for (nsIFrame* child : mFrames) {
+    MarkCachedGridMeasurementsDirty(child);
+  }
   nsContainerFrame::MarkIntrinsicISizesDirty();
 }
 
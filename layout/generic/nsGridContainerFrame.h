@@ -159,6 +159,12 @@ public:
    */
   static const nsRect& GridItemCB(nsIFrame* aChild);
 
+  /**
+   * Discard the block-size cached on aItemFrame, a grid item, by an earlier
+   * measuring reflow.  Called when the item's intrinsic sizes become dirty.
+   */
+  static void MarkCachedGridMeasurementsDirty(nsIFrame* aItemFrame);
+
   NS_DECLARE_FRAME_PROPERTY_DELETABLE(GridItemContainingBlockRect, nsRect)
 
   /**
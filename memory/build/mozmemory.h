@@ -13,6 +13,7 @@
  *   - jemalloc_purge_freed_pages
  *   - jemalloc_free_dirty_pages
  *   - jemalloc_thread_local_arena
+ *   - moz_create_arena and the other private arena functions
  */
 
 #ifndef MOZ_MEMORY
@@ -87,4 +88,30 @@ MOZ_JEMALLOC_API void jemalloc_free_dirty_pages();
 
 MOZ_JEMALLOC_API void jemalloc_thread_local_arena(jemalloc_bool enabled);
 
+/*
+ * Private arenas. moz_create_arena() returns a new arena that is only used
+ * for allocations made with the moz_arena_* functions and the returned id, so
+ * that a subsystem's allocations don't share runs with, and don't fragment,
+ * the rest of the heap. Memory allocated in a private arena must be released
+ * with moz_arena_free() or moz_arena_realloc() using the same arena id.
+ *
+ * moz_dispose_arena() returns the arena's unused pages to the system and makes
+ * the arena available for reuse by a later moz_create_arena(). All the
+ * allocations made in the arena must have been freed before it is disposed
+ * of. moz_create_arena() returns 0 when no arena could be created.
+ */
+MOZ_JEMALLOC_API arena_id_t moz_create_arena();
+
+MOZ_JEMALLOC_API void moz_dispose_arena(arena_id_t arena);
+
+MOZ_JEMALLOC_API void* moz_arena_malloc(arena_id_t arena, size_t size);
+
+MOZ_JEMALLOC_API void* moz_arena_calloc(arena_id_t arena, size_t num,
+                                        size_t size);
+
+MOZ_JEMALLOC_API void* moz_arena_realloc(arena_id_t arena, void* ptr,
+                                         size_t size);
+
+MOZ_JEMALLOC_API void moz_arena_free(arena_id_t arena, void* ptr);
+
 #endif /* mozmemory_h */
@@ -86,7 +86,7 @@ typedef struct {
  * other allocation functions, like calloc_hook.
  */
 #define MALLOC_DECL(name, return_type, ...) \
-  return_type (*name ## _hook)(return_type, __VA_ARGS__);
+  return_type (*name ## _hook)(return_type, ##__VA_ARGS__);
 #define MALLOC_DECL_VOID(name, ...) \
   void (*name ## _hook)(__VA_ARGS__);
 
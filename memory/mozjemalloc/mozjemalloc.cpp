@@ -723,6 +723,13 @@ struct arena_s {
 	 */
 	arena_chunk_t		*spare;
 
+	/*
+	 * Next arena in the list of private arenas released by
+	 * moz_dispose_arena() and available for reuse.  Protected by
+	 * arenas_lock.
+	 */
+	arena_t			*next_disposed;
+
 	/*
 	 * Current count of pages within unused runs that are potentially
 	 * dirty, and for which madvise(... MADV_FREE) has not been called.  By
@@ -2678,25 +2685,35 @@ arena_chunk_init(arena_t *arena, arena_chunk_t *chunk, bool zeroed)
 }
 
 static void
-arena_chunk_dealloc(arena_t *arena, arena_chunk_t *chunk)
+arena_spare_dealloc(arena_t *arena)
 {
 
-	if (arena->spare) {
-		if (arena->spare->ndirty > 0) {
-			arena_chunk_tree_dirty_remove(
-			    &chunk->arena->chunks_dirty, arena->spare);
-			arena->ndirty -= arena->spare->ndirty;
-			arena->stats.committed -= arena->spare->ndirty;
-		}
+	MOZ_ASSERT(arena->spare);
+
+	if (arena->spare->ndirty > 0) {
+		arena_chunk_tree_dirty_remove(&arena->chunks_dirty,
+		    arena->spare);
+		arena->ndirty -= arena->spare->ndirty;
+		arena->stats.committed -= arena->spare->ndirty;
+	}
 
 #ifdef MALLOC_DOUBLE_PURGE
-		/* This is safe to do even if arena->spare is not in the list. */
-		LinkedList_Remove(&arena->spare->chunks_madvised_elem);
+	/* This is safe to do even if arena->spare is not in the list. */
+	LinkedList_Remove(&arena->spare->chunks_madvised_elem);
 #endif
 
-		chunk_dealloc((void *)arena->spare, chunksize, ARENA_CHUNK);
-		arena->stats.mapped -= chunksize;
-		arena->stats.committed -= arena_chunk_header_npages;
+	chunk_dealloc((void *)arena->spare, chunksize, ARENA_CHUNK);
+	arena->stats.mapped -= chunksize;
+	arena->stats.committed -= arena_chunk_header_npages;
+	arena->spare = nullptr;
+}
+
+static void
+arena_chunk_dealloc(arena_t *arena, arena_chunk_t *chunk)
+{
+
+	if (arena->spare) {
+		arena_spare_dealloc(arena);
 	}
 
 	/*
@@ -3784,8 +3801,12 @@ arena_ralloc_large(void *ptr, size_t size, size_t oldsize)
 	}
 }
 
+/*
+ * If the allocation has to move, the new copy is allocated from aArena, or
+ * from the arena returned by choose_arena() when aArena is nullptr.
+ */
 static void *
-arena_ralloc(void *ptr, size_t size, size_t oldsize)
+arena_ralloc(arena_t *aArena, void *ptr, size_t size, size_t oldsize)
 {
 	void *ret;
 	size_t copysize;
@@ -3816,7 +3837,7 @@ arena_ralloc(void *ptr, size_t size, size_t oldsize)
 	 * need to move the object.  In that case, fall back to allocating new
 	 * space and copying.
 	 */
-	ret = arena_malloc(choose_arena(), size, false);
+	ret = arena_malloc(aArena ? aArena : choose_arena(), size, false);
 	if (!ret)
 		return nullptr;
 
@@ -3839,7 +3860,7 @@ IN_PLACE:
 }
 
 static inline void *
-iralloc(void *ptr, size_t size)
+iralloc(arena_t *aArena, void *ptr, size_t size)
 {
 	size_t oldsize;
 
@@ -3849,7 +3870,7 @@ iralloc(void *ptr, size_t size)
 	oldsize = isalloc(ptr);
 
 	if (size <= arena_maxclass)
-		return (arena_ralloc(ptr, size, oldsize));
+		return (arena_ralloc(aArena, ptr, size, oldsize));
 	else
 		return (huge_ralloc(ptr, size, oldsize));
 }
@@ -3872,6 +3893,7 @@ arena_new(arena_t *arena)
 	LinkedList_Init(&arena->chunks_madvised);
 #endif
 	arena->spare = nullptr;
+	arena->next_disposed = nullptr;
 
 	arena->ndirty = 0;
 
@@ -4667,7 +4689,7 @@ realloc_impl(void *ptr, size_t size)
 	if (ptr) {
 		MOZ_ASSERT(malloc_initialized);
 
-		ret = iralloc(ptr, size);
+		ret = iralloc(nullptr, ptr, size);
 
 		if (!ret) {
 			errno = ENOMEM;
@@ -5012,6 +5034,179 @@ jemalloc_free_dirty_pages_impl(void)
 	malloc_spin_unlock(&arenas_lock);
 }
 
+/*
+ * Private arenas.
+ *
+ * A private arena is an arena_t that choose_arena() never hands out, so only
+ * allocations made through the moz_arena_* functions below land in it.
+ * Huge allocations are not arena-backed and are served from the shared huge
+ * allocator as usual.  An arena_id_t is the arena_t pointer itself.
+ *
+ * An arena must be empty when it is disposed of: there is no list of the
+ * chunks an arena owns, so live allocations can't be released in bulk.
+ * Disposed arenas are purged, kept in arenas[] so that they keep being
+ * accounted for by jemalloc_stats(), and recycled by moz_create_arena().
+ */
+
+static arena_t *disposed_arenas;
+
+static inline arena_t *
+arena_from_id(arena_id_t aArenaId)
+{
+	arena_t *arena = (arena_t *)aArenaId;
+
+	MOZ_RELEASE_ASSERT(arena);
+	MOZ_DIAGNOSTIC_ASSERT(arena->magic == ARENA_MAGIC);
+	return arena;
+}
+
+MOZ_JEMALLOC_API arena_id_t
+moz_create_arena_impl(void)
+{
+	arena_t *arena;
+
+	if (malloc_init())
+		return 0;
+
+	malloc_spin_lock(&arenas_lock);
+	arena = disposed_arenas;
+	if (arena) {
+		disposed_arenas = arena->next_disposed;
+		arena->next_disposed = nullptr;
+	}
+	malloc_spin_unlock(&arenas_lock);
+
+	if (!arena) {
+		arena = arenas_extend();
+		/*
+		 * arenas_extend() falls back to the main arena when it can't
+		 * create a new one; don't hand that out as a private arena.
+		 */
+		if (arena == arenas[0])
+			return 0;
+	}
+
+	return (arena_id_t)arena;
+}
+
+MOZ_JEMALLOC_API void
+moz_dispose_arena_impl(arena_id_t aArenaId)
+{
+	arena_t *arena = arena_from_id(aArenaId);
+
+	MOZ_RELEASE_ASSERT(arena != arenas[0]);
+
+	malloc_spin_lock(&arena->lock);
+	MOZ_ASSERT(arena->stats.allocated_small == 0 &&
+	    arena->stats.allocated_large == 0);
+	arena_purge(arena, true);
+	if (arena->spare)
+		arena_spare_dealloc(arena);
+	malloc_spin_unlock(&arena->lock);
+
+	malloc_spin_lock(&arenas_lock);
+	arena->next_disposed = disposed_arenas;
+	disposed_arenas = arena;
+	malloc_spin_unlock(&arenas_lock);
+}
+
+MOZ_JEMALLOC_API void *
+moz_arena_malloc_impl(arena_id_t aArenaId, size_t size)
+{
+	arena_t *arena = arena_from_id(aArenaId);
+	void *ret;
+
+	MOZ_ASSERT(malloc_initialized);
+
+	if (size == 0) {
+		size = 1;
+	}
+
+	if (size <= arena_maxclass)
+		ret = arena_malloc(arena, size, false);
+	else
+		ret = huge_malloc(size, false);
+
+	if (!ret) {
+		errno = ENOMEM;
+	}
+
+	return (ret);
+}
+
+MOZ_JEMALLOC_API void *
+moz_arena_calloc_impl(arena_id_t aArenaId, size_t num, size_t size)
+{
+	arena_t *arena = arena_from_id(aArenaId);
+	void *ret;
+	size_t num_size;
+
+	MOZ_ASSERT(malloc_initialized);
+
+	num_size = num * size;
+	if (num_size == 0) {
+		num_size = 1;
+	} else if (((num | size) & (SIZE_T_MAX << (sizeof(size_t) << 2)))
+	    && (num_size / size != num)) {
+		/* size_t overflow. */
+		errno = ENOMEM;
+		return nullptr;
+	}
+
+	if (num_size <= arena_maxclass)
+		ret = arena_malloc(arena, num_size, true);
+	else
+		ret = huge_malloc(num_size, true);
+
+	if (!ret) {
+		errno = ENOMEM;
+	}
+
+	return (ret);
+}
+
+MOZ_JEMALLOC_API void *
+moz_arena_realloc_impl(arena_id_t aArenaId, void *ptr, size_t size)
+{
+	arena_t *arena = arena_from_id(aArenaId);
+	void *ret;
+
+	if (!ptr)
+		return moz_arena_malloc_impl(aArenaId, size);
+
+	MOZ_ASSERT(malloc_initialized);
+
+	if (size == 0) {
+		size = 1;
+	}
+
+	MOZ_ASSERT(CHUNK_ADDR2OFFSET(ptr) == 0 ||
+	    ((arena_chunk_t *)CHUNK_ADDR2BASE(ptr))->arena == arena);
+
+	ret = iralloc(arena, ptr, size);
+
+	if (!ret) {
+		errno = ENOMEM;
+	}
+
+	return (ret);
+}
+
+MOZ_JEMALLOC_API void
+moz_arena_free_impl(arena_id_t aArenaId, void *ptr)
+{
+	size_t offset;
+
+	MOZ_ASSERT(CHUNK_ADDR2OFFSET(nullptr) == 0);
+	offset = CHUNK_ADDR2OFFSET(ptr);
+	if (offset != 0) {
+		MOZ_ASSERT(((arena_chunk_t *)CHUNK_ADDR2BASE(ptr))->arena ==
+		    arena_from_id(aArenaId));
+		arena_dalloc(ptr, offset);
+	} else if (ptr)
+		huge_dalloc(ptr);
+}
+
 /*
  * End non-standard functions.
  */
@@ -247,8 +247,45 @@ MOZ_WIN_MEM_TRY_CATCH(rv = NS_ERROR_FAILURE)
 NS_IMETHODIMP
 nsJARInputStream::ReadSegments(nsWriteSegmentFun writer, void * closure, uint32_t count, uint32_t *_retval)
 {
-    // don't have a buffer to read from, so this better not be called!
-    return NS_ERROR_NOT_IMPLEMENTED;
+    NS_ENSURE_ARG_POINTER(_retval);
+
+    *_retval = 0;
+
+    // Only stored entries have a buffer to read from: the archive mapping
+    // itself, which we hand to the writer without copying it first.
+    if (mMode == MODE_CLOSED) {
+        return NS_BASE_STREAM_CLOSED;
+    }
+    if (mMode != MODE_COPY) {
+        return NS_ERROR_NOT_IMPLEMENTED;
+    }
+
+    if (!mFd) {
+        return NS_OK;
+    }
+
+    nsresult rv = NS_OK;
+MOZ_WIN_MEM_TRY_BEGIN
+    count = std::min(count, mOutSize - uint32_t(mZs.total_out));
+    if (count) {
+        rv = writer(this, closure,
+                    reinterpret_cast<const char*>(mZs.next_in + mZs.total_out),
+                    0, count, _retval);
+        if (NS_SUCCEEDED(rv)) {
+            NS_ASSERTION(*_retval <= count,
+                         "writer should not write more than we asked it to write");
+            mZs.total_out += *_retval;
+        } else {
+            *_retval = 0;
+        }
+    }
+    // be aggressive about releasing the file!
+    if (mZs.total_out >= mOutSize) {
+        mFd = nullptr;
+    }
+MOZ_WIN_MEM_TRY_CATCH(return NS_ERROR_FAILURE)
+    // errors returned from the writer end here!
+    return NS_OK;
 }
 
 NS_IMETHODIMP
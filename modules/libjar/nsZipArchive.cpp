@@ -872,6 +872,24 @@ nsZipHandle* nsZipArchive::GetFD()
   return mFd.get();
 }
 
+//---------------------------------------------
+// nsZipArchive::WillNeedEntireArchive
+//---------------------------------------------
+void nsZipArchive::WillNeedEntireArchive()
+{
+  if (!mFd || !mFd->mFileData || !mFd->mLen)
+    return;
+
+  const uint8_t* startp = mFd->mFileData;
+#if defined(XP_SOLARIS)
+  posix_madvise(const_cast<uint8_t*>(startp), mFd->mLen, POSIX_MADV_WILLNEED);
+#elif defined(XP_UNIX)
+  madvise(const_cast<uint8_t*>(startp), mFd->mLen, MADV_WILLNEED);
+#else
+  (void)startp;
+#endif
+}
+
 //---------------------------------------------
 // nsZipArchive::GetDataOffset
 //---------------------------------------------
@@ -1307,7 +1325,9 @@ nsZipItemPtr_base::nsZipItemPtr_base(nsZipArchive *aZip,
 #endif
   if (compressed) {
     size = item->RealSize();
-    mAutoBuf = MakeUniqueFallible<uint8_t[]>(size);
+    // The cursor inflates the whole member into the buffer, so there is no
+    // point in zero-filling it first.
+    mAutoBuf.reset(new (fallible) uint8_t[size]);
     if (!mAutoBuf) {
       return;
     }
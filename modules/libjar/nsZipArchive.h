@@ -200,6 +200,13 @@ public:
    */
   const uint8_t* GetData(nsZipItem* aItem);
 
+  /**
+   * Hint to the OS that the whole mapped archive will be read soon, so that
+   * it can start reading it in the background. For archives that are read
+   * almost entirely, such as the startup cache. Only acts on Unix.
+   */
+  void WillNeedEntireArchive();
+
   bool GetComment(nsACString &aComment);
 
   /**
@@ -739,7 +739,10 @@ Preferences::Init()
   nsresult rv;
 
   PREF_SetDirtyCallback(&DirtyCallback);
-  PREF_Init();
+  // Content processes are about to receive every pref the parent has, so
+  // size the table for them up front rather than growing it (and rehashing
+  // thousands of entries) a couple of times along the way.
+  PREF_Init(gInitPrefs ? gInitPrefs->Length() : 0);
 
   rv = pref_InitInitialObjects();
   NS_ENSURE_SUCCESS(rv, rv);
@@ -1006,7 +1009,7 @@ Preferences::GetPreference(PrefSetting* aPref)
 void
 Preferences::GetPreferences(InfallibleTArray<PrefSetting>* aPrefs)
 {
-  aPrefs->SetCapacity(gHashTable->Capacity());
+  aPrefs->SetCapacity(gHashTable->EntryCount());
   for (auto iter = gHashTable->Iter(); !iter.Done(); iter.Next()) {
     auto entry = static_cast<PrefHashEntry*>(iter.Get());
 
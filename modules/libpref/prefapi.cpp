@@ -5,6 +5,7 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
 
 #include "base/basictypes.h"
 
@@ -144,12 +145,13 @@ static nsresult pref_HashPref(const char *key, PrefValue value, PrefType type, u
 
 #define PREF_HASHTABLE_INITIAL_LENGTH   1024
 
-void PREF_Init()
+void PREF_Init(uint32_t aLengthHint)
 {
     if (!gHashTable) {
         gHashTable = new PLDHashTable(&pref_HashTableOps,
                                       sizeof(PrefHashEntry),
-                                      PREF_HASHTABLE_INITIAL_LENGTH);
+                                      std::max<uint32_t>(aLengthHint,
+                                                         PREF_HASHTABLE_INITIAL_LENGTH));
     }
 }
 
@@ -31,10 +31,11 @@ typedef union
 /*
 // <font color=blue>
 // The Init function initializes the preference context and creates
-// the preference hashtable.
+// the preference hashtable. aLengthHint is the number of prefs the
+// table is expected to hold; 0 means use the default size.
 // </font>
 */
-void        PREF_Init();
+void        PREF_Init(uint32_t aLengthHint = 0);
 
 /*
 // Cleanup should be called at program exit to free the
@@ -642,9 +642,12 @@ BackgroundFileSaver::ProcessStateChange()
   {
     MutexAutoLock lock(mLock);
 
+    // Copy in chunks as large as the output buffer, so that each pass of the
+    // copier hands a full buffer to the digest and to the file.
     rv = NS_AsyncCopy(mPipeInputStream, outputStream, mWorkerThread,
-                      NS_ASYNCCOPY_VIA_READSEGMENTS, 4096, AsyncCopyCallback,
-                      this, false, true, getter_AddRefs(mAsyncCopyContext),
+                      NS_ASYNCCOPY_VIA_READSEGMENTS, BUFFERED_IO_SIZE,
+                      AsyncCopyCallback, this, false, true,
+                      getter_AddRefs(mAsyncCopyContext),
                       GetProgressCallback());
     if (NS_FAILED(rv)) {
       NS_WARNING("NS_AsyncCopy failed.");
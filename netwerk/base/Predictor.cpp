@@ -1273,6 +1273,11 @@ Predictor::UpdateRollingLoadCount(nsICacheEntry *entry, const uint32_t flags,
   uint32_t rollingLoadCount = flags & ~kFlagsMask;
   rollingLoadCount <<= 1;
   uint32_t newFlags = (flags & kFlagsMask) | rollingLoadCount;
+  if (newFlags == flags) {
+    // Nothing was seen in the window, so the entry wouldn't change. Don't
+    // bother the cache with a metadata write.
+    return;
+  }
 
   // Finally, update the metadata on the cache entry.
   nsAutoCString newValue;
@@ -1934,6 +1939,11 @@ Predictor::LearnForSubresource(nsICacheEntry *entry, nsIURI *targetURI)
 
   nsCString newValue;
   MakeMetadataEntry(hitCount, lastLoad, flags, newValue);
+  if (!isNewResource && newValue.Equals(value)) {
+    // Already recorded for this load, no need to rewrite the metadata.
+    PREDICTOR_LOG(("    metadata unchanged"));
+    return;
+  }
   rv = entry->SetMetaDataElement(key.BeginReading(), newValue.BeginReading());
   PREDICTOR_LOG(("    SetMetaDataElement -> 0x%08" PRIX32, static_cast<uint32_t>(rv)));
   if (NS_FAILED(rv) && isNewResource) {
@@ -223,20 +223,21 @@ nsBaseURLParser::ParsePath(const char *path, int32_t pathLen,
 
     // XXX PL_strnpbrk would be nice, but it's buggy
 
-    // search for first occurrence of either ? or #
+    // search for the first # and then for a ? preceding it; memchr is much
+    // faster than a byte loop on long paths
     const char *query_beg = 0, *query_end = 0;
     const char *ref_beg = 0;
-    const char *p = 0;
-    for (p = path; p < path + pathLen; ++p) {
-        // only match the query string if it precedes the reference fragment
-        if (!ref_beg && !query_beg && *p == '?')
-            query_beg = p + 1;
-        else if (*p == '#') {
-            ref_beg = p + 1;
-            if (query_beg)
-                query_end = p;
-            break;
-        }
+    const char *p = static_cast<const char*>(memchr(path, '#', pathLen));
+    if (p)
+        ref_beg = p + 1;
+
+    // only match the query string if it precedes the reference fragment
+    const char *queryLimit = p ? p : path + pathLen;
+    p = static_cast<const char*>(memchr(path, '?', queryLimit - path));
+    if (p) {
+        query_beg = p + 1;
+        if (ref_beg)
+            query_end = ref_beg - 1;
     }
 
     if (query_beg) {
@@ -1201,6 +1201,7 @@ CacheFileIOManager::CacheFileIOManager()
   , mOverLimitEvicting(false)
   , mCacheSizeOnHardLimit(false)
   , mRemovingTrashDirs(false)
+  , mCachedFreeSpace(-1)
 {
   LOG(("CacheFileIOManager::CacheFileIOManager [this=%p]", this));
   MOZ_ASSERT(!gInstance, "multiple CacheFileIOManager instances!");
@@ -2123,7 +2124,8 @@ CacheFileIOManager::WriteInternal(CacheFileHandle *aHandle, int64_t aOffset,
     }
 
     int64_t freeSpace = -1;
-    rv = mCacheDirectory->GetDiskSpaceAvailable(&freeSpace);
+    rv = GetFreeSpaceForWrite(aOffset + aCount - aHandle->mFileSize,
+                              &freeSpace);
     if (NS_WARN_IF(NS_FAILED(rv))) {
       LOG(("CacheFileIOManager::WriteInternal() - GetDiskSpaceAvailable() "
            "failed! [rv=0x%08" PRIx32 "]", static_cast<uint32_t>(rv)));
@@ -2187,6 +2189,36 @@ CacheFileIOManager::WriteInternal(CacheFileHandle *aHandle, int64_t aOffset,
   return NS_OK;
 }
 
+nsresult
+CacheFileIOManager::GetFreeSpaceForWrite(int64_t aGrowth, int64_t* aFreeSpace)
+{
+  MOZ_ASSERT(CacheFileIOManager::IsOnIOThreadOrCeased());
+
+  static const TimeDuration kFreeSpaceCheckInterval =
+    TimeDuration::FromMilliseconds(1000);
+
+  TimeStamp now = TimeStamp::NowLoRes();
+  if (mCachedFreeSpace < 0 || mCachedFreeSpaceTime.IsNull() ||
+      now - mCachedFreeSpaceTime > kFreeSpaceCheckInterval) {
+    int64_t freeSpace = -1;
+    nsresult rv = mCacheDirectory->GetDiskSpaceAvailable(&freeSpace);
+    if (NS_FAILED(rv)) {
+      mCachedFreeSpace = -1;
+      return rv;
+    }
+    mCachedFreeSpace = freeSpace;
+    mCachedFreeSpaceTime = now;
+  }
+
+  *aFreeSpace = mCachedFreeSpace;
+
+  // Account for the write we're about to do until the next real check. The
+  // callers reject the write when it'd go below the hard limit, so
+  // over-estimating the usage here only errs on the safe side.
+  mCachedFreeSpace = std::max<int64_t>(mCachedFreeSpace - aGrowth, 0);
+  return NS_OK;
+}
+
 // static
 nsresult
 CacheFileIOManager::DoomFile(CacheFileHandle *aHandle,
@@ -2663,7 +2695,7 @@ CacheFileIOManager::TruncateSeekSetEOFInternal(CacheFileHandle *aHandle,
     }
 
     int64_t freeSpace = -1;
-    rv = mCacheDirectory->GetDiskSpaceAvailable(&freeSpace);
+    rv = GetFreeSpaceForWrite(aEOFPos - aHandle->mFileSize, &freeSpace);
     if (NS_WARN_IF(NS_FAILED(rv))) {
       LOG(("CacheFileIOManager::TruncateSeekSetEOFInternal() - "
            "GetDiskSpaceAvailable() failed! [rv=0x%08" PRIx32 "]",
@@ -413,6 +413,11 @@ private:
   nsresult RenameFileInternal(CacheFileHandle *aHandle,
                               const nsACString &aNewName);
   nsresult EvictIfOverLimitInternal();
+  // Returns the free space on the cache volume for the low disk space checks
+  // done when a write grows a file. The value is refreshed at most every
+  // kFreeSpaceCheckInterval and adjusted by our own writes in between, so that
+  // writing many small entries doesn't cost a statfs() per write.
+  nsresult GetFreeSpaceForWrite(int64_t aGrowth, int64_t* aFreeSpace);
   nsresult OverLimitEvictionInternal();
   nsresult EvictAllInternal();
   nsresult EvictByContextInternal(nsILoadContextInfo *aLoadContextInfo,
@@ -491,6 +496,8 @@ private:
   nsTArray<nsCString>                  mFailedTrashDirs;
   RefPtr<CacheFileContextEvictor>      mContextEvictor;
   TimeStamp                            mLastSmartSizeTime;
+  int64_t                              mCachedFreeSpace;
+  TimeStamp                            mCachedFreeSpaceTime;
 };
 
 } // namespace net
@@ -9,6 +9,7 @@
 #include "nsISupportsImpl.h"
 #include "nsPrintfCString.h"
 #include "nsThreadUtils.h"
+#include "mozilla/ArrayUtils.h"
 #include "mozilla/IOInterposer.h"
 #include "GeckoProfiler.h"
 
@@ -32,6 +33,7 @@ public:
   typedef CacheIOThread::EventQueue::size_type size_type;
   static size_type mMinLengthToReport[CacheIOThread::LAST_LEVEL];
   static void Report(uint32_t aLevel, size_type aLength);
+  static void ReportLatency(uint32_t aLevel, TimeStamp const& aQueuedSince);
 };
 
 static CacheIOTelemetry::size_type const kGranularity = 30;
@@ -72,6 +74,34 @@ void CacheIOTelemetry::Report(uint32_t aLevel, CacheIOTelemetry::size_type aLeng
   Telemetry::Accumulate(telemetryID[aLevel], aLength - 1); // counted from 0
 }
 
+// static
+void CacheIOTelemetry::ReportLatency(uint32_t aLevel,
+                                     TimeStamp const& aQueuedSince)
+{
+  if (aQueuedSince.IsNull()) {
+    return;
+  }
+
+  static const nsLiteralCString levelNames[] = {
+    NS_LITERAL_CSTRING("OPEN_PRIORITY"),
+    NS_LITERAL_CSTRING("READ_PRIORITY"),
+    NS_LITERAL_CSTRING("MANAGEMENT"),
+    NS_LITERAL_CSTRING("OPEN"),
+    NS_LITERAL_CSTRING("READ"),
+    NS_LITERAL_CSTRING("WRITE_PRIORITY"),
+    NS_LITERAL_CSTRING("WRITE"),
+    NS_LITERAL_CSTRING("INDEX"),
+    NS_LITERAL_CSTRING("EVICT")
+  };
+  static_assert(ArrayLength(levelNames) == CacheIOThread::LAST_LEVEL,
+                "Missing level name");
+
+  uint32_t latencyMs = static_cast<uint32_t>(
+    (TimeStamp::Now() - aQueuedSince).ToMilliseconds());
+  Telemetry::Accumulate(Telemetry::HTTP_CACHE_IO_QUEUE_LATENCY_MS,
+                        levelNames[aLevel], latencyMs);
+}
+
 } // anon
 
 namespace detail {
@@ -317,6 +347,12 @@ nsresult CacheIOThread::DispatchAfterPendingOpens(nsIRunnable* aRunnable)
   // where we post the (eviction) runnable.
   mQueueLength[OPEN_PRIORITY] += mEventQueue[OPEN].Length();
   mQueueLength[OPEN] -= mEventQueue[OPEN].Length();
+  if (!mQueuedSince[OPEN].IsNull() &&
+      (mQueuedSince[OPEN_PRIORITY].IsNull() ||
+       mQueuedSince[OPEN] < mQueuedSince[OPEN_PRIORITY])) {
+    mQueuedSince[OPEN_PRIORITY] = mQueuedSince[OPEN];
+  }
+  mQueuedSince[OPEN] = TimeStamp();
   mEventQueue[OPEN_PRIORITY].AppendElements(mEventQueue[OPEN]);
   mEventQueue[OPEN].Clear();
 
@@ -340,6 +376,9 @@ nsresult CacheIOThread::DispatchInternal(already_AddRefed<nsIRunnable> aRunnable
   mMonitor.AssertCurrentThreadOwns();
 
   ++mQueueLength[aLevel];
+  if (mEventQueue[aLevel].IsEmpty() && mQueuedSince[aLevel].IsNull()) {
+    mQueuedSince[aLevel] = TimeStamp::Now();
+  }
   mEventQueue[aLevel].AppendElement(runnable.forget());
   if (mLowestLevelWaiting > aLevel)
     mLowestLevelWaiting = aLevel;
@@ -541,6 +580,9 @@ void CacheIOThread::LoopOneLevel(uint32_t aLevel)
   events.SwapElements(mEventQueue[aLevel]);
   EventQueue::size_type length = events.Length();
 
+  TimeStamp queuedSince = mQueuedSince[aLevel];
+  mQueuedSince[aLevel] = TimeStamp();
+
   mCurrentlyExecutingLevel = aLevel;
 
   bool returnEvents = false;
@@ -561,6 +603,7 @@ void CacheIOThread::LoopOneLevel(uint32_t aLevel)
       if (reportTelemetry) {
         reportTelemetry = false;
         CacheIOTelemetry::Report(aLevel, length);
+        CacheIOTelemetry::ReportLatency(aLevel, queuedSince);
       }
 
       // Drop any previous flagging, only an event on the current level may set
@@ -586,8 +629,15 @@ void CacheIOThread::LoopOneLevel(uint32_t aLevel)
     }
   }
 
-  if (returnEvents)
+  if (returnEvents) {
     mEventQueue[aLevel].InsertElementsAt(0, events.Elements() + index, length - index);
+    // If the level got to run, its wait has been reported already and only
+    // the wait from now on counts for the returned events.
+    TimeStamp since = reportTelemetry ? queuedSince : TimeStamp::Now();
+    if (mQueuedSince[aLevel].IsNull() || since < mQueuedSince[aLevel]) {
+      mQueuedSince[aLevel] = since;
+    }
+  }
 }
 
 bool CacheIOThread::EventsPending(uint32_t aLastLevel)
@@ -13,6 +13,7 @@
 #include "mozilla/Monitor.h"
 #include "mozilla/DebugOnly.h"
 #include "mozilla/Atomics.h"
+#include "mozilla/TimeStamp.h"
 #include "mozilla/UniquePtr.h"
 
 class nsIRunnable;
@@ -127,6 +128,9 @@ private:
   Atomic<int32_t> mQueueLength[LAST_LEVEL];
 
   EventQueue mEventQueue[LAST_LEVEL];
+  // When the oldest event currently in each mEventQueue was dispatched, for
+  // the queue latency telemetry.  Synchronized by mMonitor.
+  TimeStamp mQueuedSince[LAST_LEVEL];
   // Raised when nsIEventTarget.Dispatch() is called on this thread
   Atomic<bool, Relaxed> mHasXPCOMEvents;
   // See YieldAndRerun() above
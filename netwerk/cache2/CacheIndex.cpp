@@ -26,7 +26,11 @@
 
 #define kMinUnwrittenChanges   300
 #define kMinDumpInterval       20000 // in milliseconds
-#define kMaxBufSize            16384
+// Size of the buffer used to read and write the index and the journal. Every
+// chunk is a separate IO event, so with 200k+ entries a small buffer turns
+// loading or writing the index into thousands of round trips through the IO
+// thread.
+#define kMaxBufSize            131072
 #define kIndexVersion          0x00000005
 #define kUpdateIndexStartDelay 50000 // in milliseconds
 
@@ -251,13 +251,10 @@ CookieServiceChild::GetCookieStringFromCookieHashTable(nsIURI                 *a
                                                        const OriginAttributes &aOriginAttrs,
                                                        nsCString              &aCookieString)
 {
-  nsCOMPtr<nsIEffectiveTLDService> TLDService =
-    do_GetService(NS_EFFECTIVETLDSERVICE_CONTRACTID);
-  NS_ASSERTION(TLDService, "Can't get TLDService");
   bool requireHostMatch;
   nsAutoCString baseDomain;
   nsCookieService::
-    GetBaseDomain(TLDService, aHostURI, baseDomain, requireHostMatch);
+    GetBaseDomain(mTLDService, aHostURI, baseDomain, requireHostMatch);
   nsCookieKey key(baseDomain, aOriginAttrs);
   CookiesList *cookiesList = nullptr;
   mCookiesMap.Get(key, &cookiesList);
@@ -279,7 +276,7 @@ CookieServiceChild::GetCookieStringFromCookieHashTable(nsIURI                 *a
     nsCookieService::CheckPrefs(permissionService, mCookieBehavior,
                                 mThirdPartySession, aHostURI,
                                 aIsForeign, nullptr,
-                                CountCookiesFromHashTable(baseDomain, aOriginAttrs));
+                                cookiesList->Length());
 
   if (cookieStatus != STATUS_ACCEPTED && cookieStatus != STATUS_ACCEPT_SESSION) {
     return;
@@ -307,14 +304,14 @@ CookieServiceChild::GetCookieStringFromCookieHashTable(nsIURI                 *a
 
     if (!cookie->Name().IsEmpty() || !cookie->Value().IsEmpty()) {
       if (!aCookieString.IsEmpty()) {
-        aCookieString.Append("; ");
+        aCookieString.AppendLiteral("; ");
       }
       if (!cookie->Name().IsEmpty()) {
-        aCookieString.Append(cookie->Name().get());
-        aCookieString.Append("=");
-        aCookieString.Append(cookie->Value().get());
+        aCookieString.Append(cookie->Name());
+        aCookieString.Append('=');
+        aCookieString.Append(cookie->Value());
       } else {
-        aCookieString.Append(cookie->Value().get());
+        aCookieString.Append(cookie->Value());
       }
     }
   }
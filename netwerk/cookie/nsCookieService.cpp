@@ -704,6 +704,7 @@ nsCookieService::nsCookieService()
  , mMaxNumberOfCookies(kMaxNumberOfCookies)
  , mMaxCookiesPerHost(kMaxCookiesPerHost)
  , mCookiePurgeAge(kCookiePurgeAge)
+ , mBatchingWrites(false)
 {
 }
 
@@ -2159,13 +2160,59 @@ nsCookieService::SetCookieStringInternal(nsIURI                 *aHostURI,
 
   int64_t serverTime = ParseServerTime(aServerTime);
 
-  // process each cookie in the header
+  // process each cookie in the header, batching the resulting DB writes
+  mBatchingWrites = aFromHttp && mDBState->dbConn;
   while (SetCookieInternal(aHostURI, key, requireHostMatch, cookieStatus,
                            aCookieHeader, serverTime, aFromHttp, aChannel)) {
     // document.cookie can only set one cookie at a time
     if (!aFromHttp)
       break;
   }
+  FlushPendingWrites();
+  mBatchingWrites = false;
+}
+
+// Returns the params array that a deferred write on aStmt should be bound to.
+// If a write of a different kind is pending it is executed first, so that the
+// relative order of inserts and deletes is preserved.
+mozIStorageBindingParamsArray*
+nsCookieService::PendingWriteParams(mozIStorageAsyncStatement    *aStmt,
+                                    mozIStorageStatementCallback *aListener)
+{
+  MOZ_ASSERT(mBatchingWrites);
+
+  if (mPendingWriteStmt != aStmt) {
+    FlushPendingWrites();
+    mPendingWriteStmt = aStmt;
+    mPendingWriteListener = aListener;
+    aStmt->NewBindingParamsArray(getter_AddRefs(mPendingWriteParams));
+  }
+  return mPendingWriteParams;
+}
+
+void
+nsCookieService::FlushPendingWrites()
+{
+  nsCOMPtr<mozIStorageAsyncStatement> stmt = mPendingWriteStmt.forget();
+  nsCOMPtr<mozIStorageBindingParamsArray> paramsArray =
+    mPendingWriteParams.forget();
+  nsCOMPtr<mozIStorageStatementCallback> listener =
+    mPendingWriteListener.forget();
+  if (!stmt || !paramsArray) {
+    return;
+  }
+
+  uint32_t length;
+  paramsArray->GetLength(&length);
+  if (!length) {
+    return;
+  }
+
+  DebugOnly<nsresult> rv = stmt->BindParameters(paramsArray);
+  NS_ASSERT_SUCCESS(rv);
+  nsCOMPtr<mozIStoragePendingStatement> handle;
+  rv = stmt->ExecuteAsync(listener, getter_AddRefs(handle));
+  NS_ASSERT_SUCCESS(rv);
 }
 
 // notify observers that a cookie was rejected due to the users' prefs.
@@ -2348,6 +2395,7 @@ nsCookieService::RemoveAll()
     return NS_ERROR_NOT_AVAILABLE;
   }
 
+  FlushPendingWrites();
   RemoveAllFromMemory();
 
   // clear the cookie file
@@ -3361,6 +3409,7 @@ nsCookieService::GetCookiesForURI(nsIURI *aHostURI,
   if (stale) {
     // Create an array of parameters to bind to our update statement. Batching
     // is OK here since we're updating cookies with no interleaved operations.
+    FlushPendingWrites();
     nsCOMPtr<mozIStorageBindingParamsArray> paramsArray;
     mozIStorageAsyncStatement* stmt = mDBState->stmtUpdate;
     if (mDBState->dbConn) {
@@ -4542,6 +4591,7 @@ nsCookieService::PurgeCookies(int64_t aCurrentTimeInUsec)
 
   // Create a params array to batch the removals. This is OK here because
   // all the removals are in order, and there are no interleaved additions.
+  FlushPendingWrites();
   mozIStorageAsyncStatement *stmt = mDBState->stmtDelete;
   nsCOMPtr<mozIStorageBindingParamsArray> paramsArray;
   if (mDBState->dbConn) {
@@ -5097,6 +5147,11 @@ nsCookieService::RemoveCookieFromList(const nsListIter              &aIter,
     // the database lock.
     mozIStorageAsyncStatement *stmt = mDBState->stmtDelete;
     nsCOMPtr<mozIStorageBindingParamsArray> paramsArray(aParamsArray);
+    bool deferred = false;
+    if (!paramsArray && mBatchingWrites) {
+      paramsArray = PendingWriteParams(stmt, mDBState->removeListener);
+      deferred = true;
+    }
     if (!paramsArray) {
       stmt->NewBindingParamsArray(getter_AddRefs(paramsArray));
     }
@@ -5127,7 +5182,7 @@ nsCookieService::RemoveCookieFromList(const nsListIter              &aIter,
     NS_ASSERT_SUCCESS(rv);
 
     // If we weren't given a params array, we'll need to remove it ourselves.
-    if (!aParamsArray) {
+    if (!aParamsArray && !deferred) {
       rv = stmt->BindParameters(paramsArray);
       NS_ASSERT_SUCCESS(rv);
       nsCOMPtr<mozIStoragePendingStatement> handle;
@@ -5256,14 +5311,20 @@ nsCookieService::AddCookieToList(const nsCookieKey             &aKey,
   if (aWriteToDB && !aCookie->IsSession() && aDBState->dbConn) {
     mozIStorageAsyncStatement *stmt = aDBState->stmtInsert;
     nsCOMPtr<mozIStorageBindingParamsArray> paramsArray(aParamsArray);
+    bool deferred = false;
+    if (!paramsArray && mBatchingWrites && aDBState == mDBState) {
+      paramsArray = PendingWriteParams(stmt, mDBState->insertListener);
+      deferred = true;
+    }
     if (!paramsArray) {
       stmt->NewBindingParamsArray(getter_AddRefs(paramsArray));
     }
     bindCookieParameters(paramsArray, aKey, aCookie);
 
-    // If we were supplied an array to store parameters, we shouldn't call
-    // executeAsync - someone up the stack will do this for us.
-    if (!aParamsArray) {
+    // If we were supplied an array to store parameters, or the write is
+    // being batched, we shouldn't call executeAsync - someone up the stack
+    // will do this for us.
+    if (!aParamsArray && !deferred) {
       DebugOnly<nsresult> rv = stmt->BindParameters(paramsArray);
       NS_ASSERT_SUCCESS(rv);
       nsCOMPtr<mozIStoragePendingStatement> handle;
@@ -268,6 +268,8 @@ class nsCookieService final : public nsICookieService
     void                          RemoveCookieFromList(const nsListIter &aIter, mozIStorageBindingParamsArray *aParamsArray = nullptr);
     void                          AddCookieToList(const nsCookieKey& aKey, nsCookie *aCookie, DBState *aDBState, mozIStorageBindingParamsArray *aParamsArray, bool aWriteToDB = true);
     void                          UpdateCookieInList(nsCookie *aCookie, int64_t aLastAccessed, mozIStorageBindingParamsArray *aParamsArray);
+    mozIStorageBindingParamsArray* PendingWriteParams(mozIStorageAsyncStatement *aStmt, mozIStorageStatementCallback *aListener);
+    void                          FlushPendingWrites();
     static bool                   GetTokenValue(nsACString::const_char_iterator &aIter, nsACString::const_char_iterator &aEndIter, nsDependentCSubstring &aTokenString, nsDependentCSubstring &aTokenValue, bool &aEqualsFound);
     static bool                   ParseAttributes(nsDependentCString &aCookieHeader, nsCookieAttributes &aCookie);
     bool                          RequireThirdPartyCheck();
@@ -325,6 +327,15 @@ class nsCookieService final : public nsICookieService
     uint16_t                      mMaxCookiesPerHost;
     int64_t                       mCookiePurgeAge;
 
+    // While a multi-cookie Set-Cookie header is being processed, consecutive
+    // inserts or deletes are collected here and executed as one statement; see
+    // PendingWriteParams(). A write of a different kind flushes the batch
+    // first, so the DB still sees every operation in order.
+    bool                                    mBatchingWrites;
+    nsCOMPtr<mozIStorageAsyncStatement>     mPendingWriteStmt;
+    nsCOMPtr<mozIStorageBindingParamsArray> mPendingWriteParams;
+    nsCOMPtr<mozIStorageStatementCallback>  mPendingWriteListener;
+
     // friends!
     friend class DBListenerErrorHandler;
     friend class ReadCookieDBListener;
@@ -60,13 +60,21 @@ static const unsigned int NEGATIVE_RECORD_LIFETIME = 60;
 // When the pool is greater than HighThreadThreshold in size a thread will be destroyed after
 // ShortIdleTimeoutSeconds of idle time. Smaller pools use LongIdleTimeoutSeconds for a
 // timeout period.
+//
+// Low priority lookups (mostly DNS prefetches) may only occupy
+// LowThreadThreshold of the HighThreadThreshold "any priority" slots, so a
+// burst of prefetches can never hold back a medium priority lookup issued on
+// behalf of a real load.
 
 #define HighThreadThreshold     MAX_RESOLVER_THREADS_FOR_ANY_PRIORITY
+#define LowThreadThreshold      (HighThreadThreshold - 1)
 #define LongIdleTimeoutSeconds  300           // for threads 1 -> HighThreadThreshold
 #define ShortIdleTimeoutSeconds 60            // for threads HighThreadThreshold+1 -> MAX_RESOLVER_THREADS
 
 static_assert(HighThreadThreshold <= MAX_RESOLVER_THREADS,
               "High Thread Threshold should be less equal Maximum allowed thread");
+static_assert(LowThreadThreshold > 0,
+              "Low priority lookups need at least one thread");
 
 //----------------------------------------------------------------------------
 
@@ -1158,7 +1166,8 @@ nsHostResolver::GetHostToLookup(nsHostRecord **result)
                 return true;
             }
 
-            if (!PR_CLIST_IS_EMPTY(&mLowQ)) {
+            if (!PR_CLIST_IS_EMPTY(&mLowQ) &&
+                mActiveAnyThreadCount < LowThreadThreshold) {
                 DeQueue (mLowQ, result);
                 mActiveAnyThreadCount++;
                 (*result)->usingAnyThread = true;
@@ -1484,14 +1493,18 @@ nsHostResolver::ThreadFunc(void *arg)
         bool getTtl = false;
 #endif
 
-        nsresult status = GetAddrInfo(rec->host, rec->af, rec->flags, rec->netInterface,
-                                      &ai, getTtl);
+        nsresult status;
+        {
+            AutoProfilerTracing tracing("Network", "DNSLookup");
+            status = GetAddrInfo(rec->host, rec->af, rec->flags, rec->netInterface,
+                                 &ai, getTtl);
 #if defined(RES_RETRY_ON_FAILURE)
-        if (NS_FAILED(status) && rs.Reset()) {
-            status = GetAddrInfo(rec->host, rec->af, rec->flags, rec->netInterface, &ai,
-                                 getTtl);
-        }
+            if (NS_FAILED(status) && rs.Reset()) {
+                status = GetAddrInfo(rec->host, rec->af, rec->flags, rec->netInterface,
+                                     &ai, getTtl);
+            }
 #endif
+        }
 
         {   // obtain lock to check shutdown and manage inter-module telemetry
             MutexAutoLock lock(resolver->mLock);
@@ -765,7 +765,7 @@ Http2Decompressor::DecodeHuffmanCharacter(const HuffmanIncomingTable *table,
 {
   uint8_t idx = ExtractByte(bitsLeft, bytesConsumed);
 
-  if (table->IndexHasANextTable(idx)) {
+  while (table->IndexHasANextTable(idx)) {
     if (bytesConsumed >= mDataLen) {
       if (!bitsLeft || (bytesConsumed > mDataLen)) {
         // TODO - does this get me into trouble in the new world?
@@ -779,7 +779,8 @@ Http2Decompressor::DecodeHuffmanCharacter(const HuffmanIncomingTable *table,
     }
 
     // We're sorry, Mario, but your princess is in another castle
-    return DecodeHuffmanCharacter(table->NextTable(idx), c, bytesConsumed, bitsLeft);
+    table = table->NextTable(idx);
+    idx = ExtractByte(bitsLeft, bytesConsumed);
   }
 
   const HuffmanIncomingEntry *entry = table->Entry(idx);
@@ -811,9 +812,18 @@ Http2Decompressor::CopyHuffmanStringFromInput(uint32_t bytes, nsACString &val)
     return NS_ERROR_FAILURE;
   }
 
+  // The shortest code is 5 bits, so the decoded string can never be longer
+  // than 8/5 of the encoded length. Size the output once up front and write
+  // characters straight into it rather than appending one at a time.
+  uint32_t maxLen = (bytes * 8) / 5 + 1;
+  if (!val.SetLength(maxLen, fallible)) {
+    return NS_ERROR_OUT_OF_MEMORY;
+  }
+  char *out = val.BeginWriting();
+  uint32_t outLen = 0;
+
   uint32_t bytesRead = 0;
   uint8_t bitsLeft = 0;
-  nsAutoCString buf;
   nsresult rv;
   uint8_t c;
 
@@ -821,17 +831,19 @@ Http2Decompressor::CopyHuffmanStringFromInput(uint32_t bytes, nsACString &val)
     uint32_t bytesConsumed = 0;
     rv = DecodeHuffmanCharacter(&HuffmanIncomingRoot, c, bytesConsumed,
                                 bitsLeft);
-    if (NS_FAILED(rv)) {
+    if (NS_FAILED(rv) || outLen >= maxLen) {
       LOG(("CopyHuffmanStringFromInput failed to decode a character"));
-      return rv;
+      val.Truncate();
+      return NS_FAILED(rv) ? rv : NS_ERROR_FAILURE;
     }
 
     bytesRead += bytesConsumed;
-    buf.Append(c);
+    out[outLen++] = c;
   }
 
   if (bytesRead > bytes) {
     LOG(("CopyHuffmanStringFromInput read more bytes than was allowed!"));
+    val.Truncate();
     return NS_ERROR_FAILURE;
   }
 
@@ -840,13 +852,14 @@ Http2Decompressor::CopyHuffmanStringFromInput(uint32_t bytes, nsACString &val)
     // character left that our loop didn't decode. Check to see if that's the
     // case, and if so, add it to our output.
     rv = DecodeFinalHuffmanCharacter(&HuffmanIncomingRoot, c, bitsLeft);
-    if (NS_SUCCEEDED(rv)) {
-      buf.Append(c);
+    if (NS_SUCCEEDED(rv) && outLen < maxLen) {
+      out[outLen++] = c;
     }
   }
 
   if (bitsLeft > 7) {
     LOG(("CopyHuffmanStringFromInput more than 7 bits of padding"));
+    val.Truncate();
     return NS_ERROR_FAILURE;
   }
 
@@ -858,11 +871,12 @@ Http2Decompressor::CopyHuffmanStringFromInput(uint32_t bytes, nsACString &val)
     if (bits != mask) {
       LOG(("CopyHuffmanStringFromInput ran out of data but found possible "
            "non-EOS symbol"));
+      val.Truncate();
       return NS_ERROR_FAILURE;
     }
   }
 
-  val = buf;
+  val.SetLength(outLen);
   LOG(("CopyHuffmanStringFromInput decoded a full string!"));
   return NS_OK;
 }
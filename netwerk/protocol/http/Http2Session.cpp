@@ -1149,6 +1149,36 @@ Http2Session::CleanupStream(uint32_t aID, nsresult aResult, errorType aResetCode
   CleanupStream(stream, aResult, aResetCode);
 }
 
+// Streams in the leader and urgent-start groups are render blocking, so let
+// them jump ahead of whatever else is queued instead of being starved behind
+// a long run of images. Queue order is otherwise preserved.
+static Http2Stream *PopNextStreamForWrite(nsDeque &queue)
+{
+  AutoTArray<Http2Stream *, 16> skipped;
+  Http2Stream *next = nullptr;
+
+  size_t size = queue.GetSize();
+  for (size_t count = 0; count < size; ++count) {
+    Http2Stream *stream = static_cast<Http2Stream *>(queue.PopFront());
+    uint32_t group = stream->PriorityDependency();
+    if (group == Http2Session::kLeaderGroupID ||
+        group == Http2Session::kUrgentStartGroupID) {
+      next = stream;
+      break;
+    }
+    skipped.AppendElement(stream);
+  }
+
+  for (size_t i = skipped.Length(); i > 0; --i) {
+    queue.PushFront(skipped[i - 1]);
+  }
+
+  if (!next) {
+    next = static_cast<Http2Stream *>(queue.PopFront());
+  }
+  return next;
+}
+
 static void RemoveStreamFromQueue(Http2Stream *aStream, nsDeque &queue)
 {
   size_t size = queue.GetSize();
@@ -2704,7 +2734,7 @@ Http2Session::ReadSegmentsAgain(nsAHttpSegmentReader *reader,
 
   LOG3(("Http2Session::ReadSegments %p", this));
 
-  Http2Stream *stream = static_cast<Http2Stream *>(mReadyForWrite.PopFront());
+  Http2Stream *stream = PopNextStreamForWrite(mReadyForWrite);
   if (!stream) {
     LOG3(("Http2Session %p could not identify a stream to write; suspending.",
           this));
@@ -846,10 +846,14 @@ HttpChannelChild::OnTransportAndData(const nsresult& channelStatus,
   // OnStatus/OnProgress event can only be fired on main thread. We need to
   // dispatch the status/progress event handling back to main thread with the
   // appropriate event target for networking.
+  // Channels with LOAD_BACKGROUND never report status/progress, so don't pay
+  // for a main thread round trip per data message just to drop it there.
   if (NS_IsMainThread()) {
     DoOnStatus(this, transportStatus);
     DoOnProgress(this, progress, progressMax);
-  } else {
+  } else if (!(mLoadFlags & LOAD_BACKGROUND)) {
+    ++mOMTMainThreadHops;
+
     RefPtr<HttpChannelChild> self = this;
     nsCOMPtr<nsIEventTarget> neckoTarget = GetNeckoTarget();
     MOZ_ASSERT(neckoTarget);
@@ -1145,6 +1149,11 @@ HttpChannelChild::CollectOMTTelemetry()
   nsAutoCString key(NS_CP_ContentTypeName(type));
 
   Telemetry::AccumulateCategoricalKeyed(key, mOMTResult);
+
+  if (mOMTResult == LABELS_HTTP_CHILD_OMT_STATS::success) {
+    Telemetry::Accumulate(Telemetry::HTTP_CHILD_OMT_MAIN_THREAD_HOPS, key,
+                          mOMTMainThreadHops);
+  }
 }
 
 void
@@ -431,6 +431,10 @@ private:
   // |notRequested| represents OMT is not requested by the channel owner.
   LABELS_HTTP_CHILD_OMT_STATS mOMTResult = LABELS_HTTP_CHILD_OMT_STATS::notRequested;
 
+  // Number of times OnTransportAndData, running on the retargeted thread, had
+  // to bounce status/progress notifications back to the main thread.
+  Atomic<uint32_t, Relaxed> mOMTMainThreadHops{0};
+
   friend class AssociateApplicationCacheEvent;
   friend class StartRequestEvent;
   friend class StopRequestEvent;
@@ -224,6 +224,7 @@ struct ParamTraits<mozilla::net::nsHttpResponseHead>
         !ReadParam(aMsg, aIter, &aResult->mPragmaNoCache))
       return false;
 
+    aResult->InvalidateParsedDate();
     return true;
   }
 };
@@ -7,10 +7,13 @@
 // HttpLog.h should generally be included first
 #include "HttpLog.h"
 
+#include <algorithm>
 #include <inttypes.h>
 
 #include "mozilla/dom/nsCSPContext.h"
+#include "mozilla/ClearOnShutdown.h"
 #include "mozilla/ScopeExit.h"
+#include "mozilla/StaticPtr.h"
 #include "mozilla/Sprintf.h"
 
 #include "nsHttp.h"
@@ -84,6 +87,7 @@
 #include "nsISiteSecurityService.h"
 #include "nsString.h"
 #include "nsCRT.h"
+#include "nsDataHashtable.h"
 #include "CacheObserver.h"
 #include "mozilla/dom/Performance.h"
 #include "mozilla/Telemetry.h"
@@ -129,6 +133,61 @@ static uint32_t sRCWNQueueSizePriority = 10;
 static uint32_t sRCWNSmallResourceSizeKB = 256;
 static uint32_t sRCWNMaxWaitMs = 500;
 
+// Per-host record of recent race-cache-with-network outcomes. Each network
+// win raises the score and each cache win lowers it; hosts whose score
+// reaches kRCWNRaceImmediatelyScore have the network triggered without
+// giving the cache a headstart. Main thread only.
+typedef nsDataHashtable<nsCStringHashKey, int32_t> RCWNHostScoreTable;
+static StaticAutoPtr<RCWNHostScoreTable> sRCWNHostScores;
+static const int32_t kRCWNHostScoreLimit = 4;
+static const int32_t kRCWNRaceImmediatelyScore = 2;
+static const uint32_t kRCWNMaxTrackedHosts = 256;
+
+void
+RecordRCWNOutcome(nsIURI *aURI, bool aNetworkWon)
+{
+    MOZ_ASSERT(NS_IsMainThread());
+
+    nsAutoCString host;
+    if (!aURI || NS_FAILED(aURI->GetAsciiHost(host)) || host.IsEmpty()) {
+        return;
+    }
+
+    if (!sRCWNHostScores) {
+        sRCWNHostScores = new RCWNHostScoreTable();
+        ClearOnShutdown(&sRCWNHostScores);
+    }
+
+    int32_t score = 0;
+    if (!sRCWNHostScores->Get(host, &score) &&
+        sRCWNHostScores->Count() >= kRCWNMaxTrackedHosts) {
+        // Keep the table bounded; stale entries are cheap to relearn.
+        sRCWNHostScores->Clear();
+    }
+
+    if (aNetworkWon) {
+        score = std::min(score + 1, kRCWNHostScoreLimit);
+    } else {
+        score = std::max(score - 1, -kRCWNHostScoreLimit);
+    }
+    sRCWNHostScores->Put(host, score);
+}
+
+bool
+ShouldRaceNetworkImmediately(nsIURI *aURI)
+{
+    MOZ_ASSERT(NS_IsMainThread());
+
+    nsAutoCString host;
+    if (!sRCWNHostScores || !aURI || NS_FAILED(aURI->GetAsciiHost(host))) {
+        return false;
+    }
+
+    int32_t score = 0;
+    return sRCWNHostScores->Get(host, &score) &&
+           score >= kRCWNRaceImmediatelyScore;
+}
+
 // True if the local cache should be bypassed when processing a request.
 #define BYPASS_LOCAL_CACHE(loadFlags) \
         (loadFlags & (nsIRequest::LOAD_BYPASS_CACHE | \
@@ -4994,6 +5053,7 @@ nsHttpChannel::ReadFromCache(bool alreadyMarkedValid)
     if (mNetworkTriggerTimer) {
         mNetworkTriggerTimer->Cancel();
         mNetworkTriggerTimer = nullptr;
+        RecordRCWNOutcome(mURI, false);
     }
 
     if (mRaceCacheWithNetwork) {
@@ -5001,6 +5061,7 @@ nsHttpChannel::ReadFromCache(bool alreadyMarkedValid)
         if (mFirstResponseSource == RESPONSE_PENDING) {
             LOG(("First response from cache\n"));
             mFirstResponseSource = RESPONSE_FROM_CACHE;
+            RecordRCWNOutcome(mURI, false);
 
             // Cancel the transaction because we will serve the request from the cache
             CancelNetworkRequest(NS_BINDING_ABORTED);
@@ -7050,6 +7111,7 @@ nsHttpChannel::OnStartRequest(nsIRequest *request, nsISupports *ctxt)
             MOZ_ASSERT(request == mTransactionPump);
             LOG(("  First response from network\n"));
             mFirstResponseSource = RESPONSE_FROM_NETWORK;
+            RecordRCWNOutcome(mURI, true);
             mAvailableCachedAltDataType.Truncate();
         } else if (WRONG_RACING_RESPONSE_SOURCE(request)) {
             LOG(("  Early return when racing. This response not needed."));
@@ -9284,6 +9346,11 @@ nsHttpChannel::MaybeRaceCacheWithNetwork()
     if (CacheFileUtils::CachePerfStats::IsCacheSlow()) {
         // If the cache is slow, trigger the network request immediately.
         mRaceDelay = 0;
+    } else if (ShouldRaceNetworkImmediately(mURI)) {
+        // The network has recently been winning races against the cache for
+        // this host, so don't hold it back.
+        LOG(("  network recently won races for this host\n"));
+        mRaceDelay = 0;
     } else {
         // Give cache a headstart of 3 times the average cache entry open time.
         mRaceDelay = CacheFileUtils::CachePerfStats::GetAverage(
@@ -42,6 +42,9 @@ nsHttpResponseHead::nsHttpResponseHead(const nsHttpResponseHead &aOther)
     mCacheControlNoCache = other.mCacheControlNoCache;
     mCacheControlImmutable = other.mCacheControlImmutable;
     mPragmaNoCache = other.mPragmaNoCache;
+    mDateParsed = other.mDateParsed;
+    mDateAvailable = other.mDateAvailable;
+    mDateValue = other.mDateValue;
 }
 
 nsHttpResponseHead&
@@ -63,6 +66,9 @@ nsHttpResponseHead::operator=(const nsHttpResponseHead &aOther)
     mCacheControlNoCache = other.mCacheControlNoCache;
     mCacheControlImmutable = other.mCacheControlImmutable;
     mPragmaNoCache = other.mPragmaNoCache;
+    mDateParsed = other.mDateParsed;
+    mDateAvailable = other.mDateAvailable;
+    mDateValue = other.mDateValue;
 
     return *this;
 }
@@ -187,6 +193,8 @@ nsHttpResponseHead::SetHeader_locked(nsHttpAtom atom,
         ParseCacheControl(mHeaders.PeekHeader(atom));
     else if (atom == nsHttp::Pragma)
         ParsePragma(mHeaders.PeekHeader(atom));
+    else if (atom == nsHttp::Date)
+        InvalidateParsedDate();
 
     return NS_OK;
 }
@@ -204,6 +212,9 @@ nsHttpResponseHead::ClearHeader(nsHttpAtom h)
 {
     RecursiveMutexAutoLock monitor(mRecursiveMutex);
     mHeaders.ClearHeader(h);
+    if (h == nsHttp::Date) {
+        InvalidateParsedDate();
+    }
 }
 
 void
@@ -211,6 +222,7 @@ nsHttpResponseHead::ClearHeaders()
 {
     RecursiveMutexAutoLock monitor(mRecursiveMutex);
     mHeaders.Clear();
+    InvalidateParsedDate();
 }
 
 bool
@@ -641,6 +653,8 @@ nsHttpResponseHead::ParseHeaderLine_locked(const nsACString &line, bool original
         ParseCacheControl(val.get());
     else if (hdr == nsHttp::Pragma)
         ParsePragma(val.get());
+    else if (hdr == nsHttp::Date)
+        InvalidateParsedDate();
     return NS_OK;
 }
 
@@ -938,6 +952,7 @@ nsHttpResponseHead::Reset()
     RecursiveMutexAutoLock monitor(mRecursiveMutex);
 
     mHeaders.Clear();
+    InvalidateParsedDate();
 
     mVersion = NS_HTTP_VERSION_1_1;
     mStatus = 200;
@@ -37,6 +37,9 @@ public:
                          , mCacheControlNoCache(false)
                          , mCacheControlImmutable(false)
                          , mPragmaNoCache(false)
+                         , mDateParsed(false)
+                         , mDateAvailable(false)
+                         , mDateValue(0)
                          , mRecursiveMutex("nsHttpResponseHead.mRecursiveMutex")
                          , mInVisitHeaders(false) {}
 
@@ -160,11 +163,24 @@ private:
     MOZ_MUST_USE nsresult GetExpiresValue_locked(uint32_t *result) const;
     MOZ_MUST_USE nsresult GetMaxAgeValue_locked(uint32_t *result) const;
 
+    // The Date header is consulted several times per cache validation, so
+    // the parsed value is remembered until the header changes.
     MOZ_MUST_USE nsresult GetDateValue_locked(uint32_t *result) const
     {
-        return ParseDateHeader(nsHttp::Date, result);
+        if (!mDateParsed) {
+            mDateAvailable =
+                NS_SUCCEEDED(ParseDateHeader(nsHttp::Date, &mDateValue));
+            mDateParsed = true;
+        }
+        if (!mDateAvailable) {
+            return NS_ERROR_NOT_AVAILABLE;
+        }
+        *result = mDateValue;
+        return NS_OK;
     }
 
+    void InvalidateParsedDate() { mDateParsed = false; }
+
     MOZ_MUST_USE nsresult GetLastModifiedValue_locked(uint32_t *result) const
     {
         return ParseDateHeader(nsHttp::Last_Modified, result);
@@ -184,6 +200,9 @@ private:
     bool              mCacheControlNoCache;
     bool              mCacheControlImmutable;
     bool              mPragmaNoCache;
+    mutable bool      mDateParsed;
+    mutable bool      mDateAvailable;
+    mutable uint32_t  mDateValue;
 
     // We are using RecursiveMutex instead of a Mutex because VisitHeader
     // function calls nsIHttpHeaderVisitor::VisitHeader while under lock.
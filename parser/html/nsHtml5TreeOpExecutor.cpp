@@ -69,6 +69,7 @@ nsHtml5TreeOpExecutor::nsHtml5TreeOpExecutor()
   : nsHtml5DocumentBuilder(false)
   , mSuppressEOF(false)
   , mReadingFromStage(false)
+  , mOpQueueStart(0)
   , mStreamParser(nullptr)
   , mPreloadedURLs(23)  // Mean # of preloadable resources per page on dmoz
   , mSpeculationReferrerPolicy(mozilla::net::RP_Unset)
@@ -82,7 +83,7 @@ nsHtml5TreeOpExecutor::nsHtml5TreeOpExecutor()
 nsHtml5TreeOpExecutor::~nsHtml5TreeOpExecutor()
 {
   if (gBackgroundFlushList && isInList()) {
-    mOpQueue.Clear();
+    ClearOpQueue();
     removeFrom(*gBackgroundFlushList);
     if (gBackgroundFlushList->isEmpty()) {
       delete gBackgroundFlushList;
@@ -374,7 +375,7 @@ nsHtml5TreeOpExecutor::RunFlushLoop()
   for (;;) {
     if (!mParser) {
       // Parse has terminated.
-      mOpQueue.Clear(); // clear in order to be able to assert in destructor
+      ClearOpQueue(); // clear in order to be able to assert in destructor
       return;
     }
 
@@ -412,7 +413,7 @@ nsHtml5TreeOpExecutor::RunFlushLoop()
         iter->Perform(this);
         if (MOZ_UNLIKELY(!mParser)) {
           // An extension terminated the parser from a HTTP observer.
-          mOpQueue.Clear(); // clear in order to be able to assert in destructor
+          ClearOpQueue(); // clear in order to be able to assert in destructor
           return;
         }
       }
@@ -422,7 +423,7 @@ nsHtml5TreeOpExecutor::RunFlushLoop()
                                // URLs.
       if (MOZ_UNLIKELY(!mParser)) {
         // An extension terminated the parser from a HTTP observer.
-        mOpQueue.Clear(); // clear in order to be able to assert in destructor
+        ClearOpQueue(); // clear in order to be able to assert in destructor
         return;
       }
       // Not sure if this grip is still needed, but previously, the code
@@ -439,7 +440,7 @@ nsHtml5TreeOpExecutor::RunFlushLoop()
       }
     }
 
-    if (mOpQueue.IsEmpty()) {
+    if (mOpQueue.Length() == mOpQueueStart) {
       // Avoid bothering the rest of the engine with a doc update if there's 
       // nothing to do.
       return;
@@ -452,9 +453,9 @@ nsHtml5TreeOpExecutor::RunFlushLoop()
     
     BeginDocUpdate();
 
-    uint32_t numberOfOpsToFlush = mOpQueue.Length();
+    uint32_t numberOfOpsToFlush = mOpQueue.Length() - mOpQueueStart;
 
-    const nsHtml5TreeOperation* first = mOpQueue.Elements();
+    const nsHtml5TreeOperation* first = mOpQueue.Elements() + mOpQueueStart;
     const nsHtml5TreeOperation* last = first + numberOfOpsToFlush - 1;
     for (nsHtml5TreeOperation* iter = const_cast<nsHtml5TreeOperation*>(first);;) {
       if (MOZ_UNLIKELY(!mParser)) {
@@ -475,7 +476,13 @@ nsHtml5TreeOpExecutor::RunFlushLoop()
       } else if (MOZ_UNLIKELY(interrupted) ||
                  MOZ_UNLIKELY(nsContentSink::DidProcessATokenImpl() ==
                               NS_ERROR_HTMLPARSER_INTERRUPTED)) {
-        mOpQueue.RemoveElementsAt(0, (iter - first) + 1);
+        mOpQueueStart += (iter - first) + 1;
+        if (mOpQueueStart >= mOpQueue.Length() - mOpQueueStart) {
+          // The performed ops now outnumber the pending ones, so dropping
+          // them costs no more than the work already done on them.
+          mOpQueue.RemoveElementsAt(0, mOpQueueStart);
+          mOpQueueStart = 0;
+        }
         
         EndDocUpdate();
 
@@ -491,7 +498,7 @@ nsHtml5TreeOpExecutor::RunFlushLoop()
       ++iter;
     }
     
-    mOpQueue.Clear();
+    ClearOpQueue();
     
     EndDocUpdate();
 
@@ -532,7 +539,7 @@ nsHtml5TreeOpExecutor::FlushDocumentWrite()
 
   if (MOZ_UNLIKELY(!mParser)) {
     // The parse has ended.
-    mOpQueue.Clear(); // clear in order to be able to assert in destructor
+    ClearOpQueue(); // clear in order to be able to assert in destructor
     return rv;
   }
   
@@ -560,9 +567,9 @@ nsHtml5TreeOpExecutor::FlushDocumentWrite()
   
   BeginDocUpdate();
 
-  uint32_t numberOfOpsToFlush = mOpQueue.Length();
+  uint32_t numberOfOpsToFlush = mOpQueue.Length() - mOpQueueStart;
 
-  const nsHtml5TreeOperation* start = mOpQueue.Elements();
+  const nsHtml5TreeOperation* start = mOpQueue.Elements() + mOpQueueStart;
   const nsHtml5TreeOperation* end = start + numberOfOpsToFlush;
   for (nsHtml5TreeOperation* iter = const_cast<nsHtml5TreeOperation*>(start);
        iter < end;
@@ -580,7 +587,7 @@ nsHtml5TreeOpExecutor::FlushDocumentWrite()
     }
   }
 
-  mOpQueue.Clear();
+  ClearOpQueue();
   
   EndDocUpdate();
 
@@ -59,6 +59,14 @@ class nsHtml5TreeOpExecutor final : public nsHtml5DocumentBuilder,
     
     bool                                 mReadingFromStage;
     nsTArray<nsHtml5TreeOperation>       mOpQueue;
+
+    /**
+     * Index of the first op in mOpQueue that hasn't been performed yet. Ops
+     * before it were performed by a flush that got interrupted and are only
+     * removed once enough of them accumulate, so that interrupting a large
+     * queue doesn't shift the remaining ops every time.
+     */
+    uint32_t                             mOpQueueStart;
     nsHtml5StreamParser*                 mStreamParser;
     
     /**
@@ -307,6 +315,12 @@ class nsHtml5TreeOpExecutor final : public nsHtml5DocumentBuilder,
      * list of preloaded URIs
      */
     bool ShouldPreloadURI(nsIURI *aURI);
+
+    void ClearOpQueue()
+    {
+      mOpQueue.Clear();
+      mOpQueueStart = 0;
+    }
 };
 
 #endif // nsHtml5TreeOpExecutor_h
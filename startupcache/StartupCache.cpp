@@ -241,6 +241,11 @@ StartupCache::LoadArchive()
 
   mArchive = new nsZipArchive();
   rv = mArchive->OpenArchive(mFile);
+  if (NS_SUCCEEDED(rv)) {
+    // Nearly every entry is read during startup, on demand and in no
+    // particular order, so let the OS start paging in the whole file now.
+    mArchive->WillNeedEntireArchive();
+  }
   return rv;
 }
 
@@ -279,7 +284,8 @@ StartupCache::GetBuffer(const char* id, UniquePtr<char[]>* outbuf, uint32_t* len
     nsDependentCString idStr(id);
     mTable.Get(idStr, &entry);
     if (entry) {
-      *outbuf = MakeUnique<char[]>(entry->size);
+      // Not MakeUnique, which would zero the buffer we're about to fill.
+      outbuf->reset(new char[entry->size]);
       memcpy(outbuf->get(), entry->data.get(), entry->size);
       *length = entry->size;
       return NS_OK;
@@ -311,7 +317,7 @@ StartupCache::PutBuffer(const char* id, const char* inbuf, uint32_t len)
     return NS_ERROR_NOT_AVAILABLE;
   }
 
-  auto data = MakeUnique<char[]>(len);
+  UniquePtr<char[]> data(new char[len]);
   memcpy(data.get(), inbuf, len);
 
   nsCString idStr(id);
@@ -619,7 +619,13 @@ xFetch(sqlite3_file *pFile, sqlite3_int64 iOff, int iAmt, void **pp)
 {
   telemetry_file *p = (telemetry_file *)pFile;
   MOZ_ASSERT(p->pReal->pMethods->iVersion >= 3);
-  return p->pReal->pMethods->xFetch(p->pReal, iOff, iAmt, pp);
+  int rc = p->pReal->pMethods->xFetch(p->pReal, iOff, iAmt, pp);
+  // A mapped page is a read that never reaches xRead; count it so the per
+  // database read volume stays accurate when mmap_size is enabled.
+  if (rc == SQLITE_OK && *pp) {
+    Telemetry::Accumulate(p->histograms->readB, iAmt);
+  }
+  return rc;
 }
 
 int
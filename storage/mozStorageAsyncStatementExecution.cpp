@@ -4,6 +4,8 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this
  * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <algorithm>
+
 #include "nsAutoPtr.h"
 
 #include "sqlite3.h"
@@ -35,9 +37,15 @@ namespace storage {
  * consumers are trying to avoid blocking their execution thread for long
  * periods of time, and dispatching many small events to the calling thread will
  * end up blocking it.
+ *
+ * The row limit starts at MAX_ROWS_PER_RESULT, so the first results of a query
+ * still arrive quickly, and doubles with each result set delivered, up to
+ * MAX_ROWS_PER_RESULT_LIMIT.  Queries returning thousands of rows would
+ * otherwise flood the calling thread with tiny events.
  */
 #define MAX_MILLISECONDS_BETWEEN_RESULTS 75
 #define MAX_ROWS_PER_RESULT 15
+#define MAX_ROWS_PER_RESULT_LIMIT 480
 
 ////////////////////////////////////////////////////////////////////////////////
 //// AsyncExecuteStatements
@@ -88,6 +96,7 @@ AsyncExecuteStatements::AsyncExecuteStatements(StatementDataArray &aStatements,
 , mCallingThread(::do_GetCurrentThread())
 , mMaxWait(TimeDuration::FromMilliseconds(MAX_MILLISECONDS_BETWEEN_RESULTS))
 , mIntervalStart(TimeStamp::Now())
+, mMaxRowsPerResult(MAX_ROWS_PER_RESULT)
 , mState(PENDING)
 , mCancelRequested(false)
 , mMutex(aConnection->sharedAsyncExecutionMutex)
@@ -305,7 +314,8 @@ AsyncExecuteStatements::buildAndNotifyResults(sqlite3_stmt *aStatement)
   // calling thread about it.
   TimeStamp now = TimeStamp::Now();
   TimeDuration delta = now - mIntervalStart;
-  if (mResultSet->rows() >= MAX_ROWS_PER_RESULT || delta > mMaxWait) {
+  if (uint32_t(mResultSet->rows()) >= mMaxRowsPerResult ||
+      delta > mMaxWait) {
     // Notify the caller
     rv = notifyResults();
     if (NS_FAILED(rv))
@@ -313,6 +323,10 @@ AsyncExecuteStatements::buildAndNotifyResults(sqlite3_stmt *aStatement)
 
     // Reset our start time
     mIntervalStart = now;
+
+    // Batch more rows into the next result set.
+    mMaxRowsPerResult = std::min<uint32_t>(mMaxRowsPerResult * 2,
+                                           MAX_ROWS_PER_RESULT_LIMIT);
   }
 
   return NS_OK;
@@ -212,6 +212,14 @@ private:
    */
   TimeStamp mIntervalStart;
 
+  /**
+   * The number of rows to batch into the next result set.  Starts at
+   * MAX_ROWS_PER_RESULT and grows with every notification, up to
+   * MAX_ROWS_PER_RESULT_LIMIT, so large queries take fewer round trips to the
+   * calling thread.
+   */
+  uint32_t mMaxRowsPerResult;
+
   /**
    * Indicates our state of execution.
    */
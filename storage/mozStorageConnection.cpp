@@ -786,6 +786,16 @@ Connection::initializeInternal()
   (void)ExecuteSimpleSQL(NS_LITERAL_CSTRING("PRAGMA temp_store = 2;"));
 #endif
 
+  // Let SQLite serve reads straight from the page cache if asked to.  Writes
+  // still go through xWrite, so quota tracking in TelemetryVFS is unaffected.
+  int32_t mmapSize = Service::getMmapSize();
+  if (mmapSize > 0 && mDatabaseFile) {
+    nsAutoCString mmapSizeQuery(MOZ_STORAGE_UNIQUIFY_QUERY_STR
+                                "PRAGMA mmap_size = ");
+    mmapSizeQuery.AppendInt(mmapSize);
+    (void)executeSql(mDBConn, mmapSizeQuery.get());
+  }
+
   // Register our built-in SQL functions.
   srv = registerFunctions(mDBConn);
   if (srv != SQLITE_OK) {
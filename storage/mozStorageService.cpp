@@ -51,6 +51,11 @@
 // db/sqlite3/src/Makefile.in.
 #define PREF_TS_PAGESIZE_DEFAULT 32768
 
+// Memory-mapped reads are off by default: an I/O error on a mapped page turns
+// into a crash rather than an error code.
+#define PREF_TS_MMAPSIZE "toolkit.storage.mmapSize"
+#define PREF_TS_MMAPSIZE_DEFAULT 0
+
 namespace mozilla {
 namespace storage {
 
@@ -265,6 +270,8 @@ Service::getSynchronousPref()
 
 int32_t Service::sDefaultPageSize = PREF_TS_PAGESIZE_DEFAULT;
 
+int32_t Service::sMmapSize = PREF_TS_MMAPSIZE_DEFAULT;
+
 Service::Service()
 : mMutex("Service::mMutex")
 , mSqliteVFS(nullptr)
@@ -583,6 +590,9 @@ Service::initialize()
   sDefaultPageSize =
       Preferences::GetInt(PREF_TS_PAGESIZE, PREF_TS_PAGESIZE_DEFAULT);
 
+  // Same for toolkit.storage.mmapSize.
+  sMmapSize = Preferences::GetInt(PREF_TS_MMAPSIZE, PREF_TS_MMAPSIZE_DEFAULT);
+
   mozilla::RegisterWeakMemoryReporter(this);
   mozilla::RegisterStorageSQLiteDistinguishedAmount(StorageSQLiteDistinguishedAmount);
 
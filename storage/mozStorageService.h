@@ -80,6 +80,16 @@ public:
     return sDefaultPageSize;
   }
 
+  /**
+   * Obtains the mmap_size, in bytes, to use for new connections.  This is 0,
+   * meaning memory-mapped I/O is disabled, unless the PREF_TS_MMAPSIZE hidden
+   * preference says otherwise.
+   */
+  static int32_t getMmapSize()
+  {
+    return sMmapSize;
+  }
+
   /**
    * Returns a boolean value indicating whether or not the given page size is
    * valid (currently understood as a power of 2 between 512 and 65536).
@@ -189,6 +199,7 @@ private:
 
   static int32_t sSynchronousPref;
   static int32_t sDefaultPageSize;
+  static int32_t sMmapSize;
 };
 
 } // namespace storage
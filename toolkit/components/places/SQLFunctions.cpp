@@ -629,6 +629,7 @@ namespace places {
             ) + redirectsTransitionFragment + NS_LITERAL_CSTRING(
           "WHERE v.place_id = :page_id "
           "ORDER BY v.visit_date DESC "
+          "LIMIT :max_visits "
         )
       );
       NS_ENSURE_STATE(getVisits);
@@ -636,10 +637,14 @@ namespace places {
       rv = getVisits->BindInt64ByName(NS_LITERAL_CSTRING("page_id"), pageId);
       NS_ENSURE_SUCCESS(rv, rv);
 
-      // Fetch only a limited number of recent visits.
+      // Fetch only a limited number of recent visits.  Passing the limit to
+      // SQLite lets it stop early instead of producing and ordering every
+      // visit to the page.
+      int32_t maxVisits = history->GetNumVisitsForFrecency();
+      rv = getVisits->BindInt32ByName(NS_LITERAL_CSTRING("max_visits"), maxVisits);
+      NS_ENSURE_SUCCESS(rv, rv);
       bool hasResult = false;
-      for (int32_t maxVisits = history->GetNumVisitsForFrecency();
-           numSampledVisits < maxVisits &&
+      for (; numSampledVisits < maxVisits &&
            NS_SUCCEEDED(getVisits->ExecuteStep(&hasResult)) && hasResult;
            numSampledVisits++) {
 
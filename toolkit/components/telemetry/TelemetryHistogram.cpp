@@ -34,6 +34,8 @@ using base::BooleanHistogram;
 using base::CountHistogram;
 using base::FlagHistogram;
 using base::LinearHistogram;
+using mozilla::Atomic;
+using mozilla::Relaxed;
 using mozilla::StaticMutex;
 using mozilla::StaticMutexAutoLock;
 using mozilla::Telemetry::Accumulation;
@@ -190,9 +192,12 @@ namespace {
 bool gInitDone = false;
 
 // Whether we are collecting the base, opt-out, Histogram data.
-bool gCanRecordBase = false;
+// These flags and gHistogramRecordingDisabled are only written with
+// gTelemetryHistogramMutex held, but are atomic so that child processes can
+// check them without taking the lock; see TelemetryHistogram::Accumulate.
+Atomic<bool, Relaxed> gCanRecordBase(false);
 // Whether we are collecting the extended, opt-in, Histogram data.
-bool gCanRecordExtended = false;
+Atomic<bool, Relaxed> gCanRecordExtended(false);
 
 // The storage for actual Histogram instances.
 // We use separate ones for plain and keyed histograms.
@@ -209,7 +214,7 @@ Histogram* gExpiredHistogram = nullptr;
 
 // This tracks whether recording is enabled for specific histograms.
 // To utilize C++ initialization rules, we invert the meaning to "disabled".
-bool gHistogramRecordingDisabled[HistogramCount] = {};
+Atomic<bool, Relaxed> gHistogramRecordingDisabled[HistogramCount];
 
 // This is for gHistogramInfos, gHistogramStringTable
 #include "TelemetryHistogramData.inc"
@@ -1793,6 +1798,15 @@ TelemetryHistogram::Accumulate(HistogramID aID,
     return;
   }
 
+  if (!XRE_IsParentProcess()) {
+    // Child processes only forward samples to TelemetryIPCAccumulator, which
+    // has its own lock, so don't contend on gTelemetryHistogramMutex here.
+    if (internal_CanRecordBase()) {
+      internal_RemoteAccumulate(aID, aSample);
+    }
+    return;
+  }
+
   StaticMutexAutoLock locker(gTelemetryHistogramMutex);
   internal_Accumulate(aID, aSample);
 }
@@ -1880,15 +1894,11 @@ TelemetryHistogram::AccumulateCategorical(HistogramID aId,
     return;
   }
 
-  StaticMutexAutoLock locker(gTelemetryHistogramMutex);
-  if (!internal_CanRecordBase()) {
-    return;
-  }
   uint32_t labelId = 0;
   if (NS_FAILED(gHistogramInfos[aId].label_id(label.get(), &labelId))) {
     return;
   }
-  internal_Accumulate(aId, labelId);
+  Accumulate(aId, labelId);
 }
 
 void
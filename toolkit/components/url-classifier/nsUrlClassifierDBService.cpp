@@ -286,17 +286,28 @@ nsUrlClassifierDBServiceWorker::HandlePendingLookups()
     return NS_ERROR_ABORT;
   }
 
-  MutexAutoLock lock(mPendingLookupLock);
-  while (mPendingLookups.Length() > 0) {
-    PendingLookup lookup = mPendingLookups[0];
-    mPendingLookups.RemoveElementAt(0);
-    {
-      MutexAutoUnlock unlock(mPendingLookupLock);
+  // Take the whole queue in one go rather than popping the front entry under
+  // the lock each time: a page load can queue hundreds of lookups, and the
+  // per-entry RemoveElementAt(0) made draining them quadratic.
+  nsTArray<PendingLookup> lookups;
+  {
+    MutexAutoLock lock(mPendingLookupLock);
+    lookups.SwapElements(mPendingLookups);
+  }
+
+  while (!lookups.IsEmpty()) {
+    for (PendingLookup& lookup : lookups) {
       DoLookup(lookup.mKey, lookup.mTables, lookup.mCallback);
+      double lookupTime =
+        (TimeStamp::Now() - lookup.mStartTime).ToMilliseconds();
+      Telemetry::Accumulate(Telemetry::URLCLASSIFIER_LOOKUP_TIME_2,
+                            static_cast<uint32_t>(lookupTime));
     }
-    double lookupTime = (TimeStamp::Now() - lookup.mStartTime).ToMilliseconds();
-    Telemetry::Accumulate(Telemetry::URLCLASSIFIER_LOOKUP_TIME_2,
-                          static_cast<uint32_t>(lookupTime));
+    lookups.Clear();
+
+    // Pick up anything that was queued while we were busy.
+    MutexAutoLock lock(mPendingLookupLock);
+    lookups.SwapElements(mPendingLookups);
   }
 
   return NS_OK;
@@ -265,13 +265,20 @@ nsUrlClassifierPrefixSet::Contains(uint32_t aPrefix, bool* aFound)
     i--;
   }
 
-  // Now search through the deltas for the target.
+  // Now search through the deltas for the target. The deltas are
+  // non-negative, so once the next one overshoots the remaining distance the
+  // target cannot be in this chunk and there is no point walking the rest.
   uint32_t diff = target - mIndexPrefixes[i];
-  uint32_t deltaSize  = mIndexDeltas[i].Length();
+  const nsTArray<uint16_t>& deltas = mIndexDeltas[i];
+  uint32_t deltaSize  = deltas.Length();
   uint32_t deltaIndex = 0;
 
   while (diff > 0 && deltaIndex < deltaSize) {
-    diff -= mIndexDeltas[i][deltaIndex];
+    uint16_t delta = deltas[deltaIndex];
+    if (delta > diff) {
+      break;
+    }
+    diff -= delta;
     deltaIndex++;
   }
 
@@ -45,7 +45,11 @@ ProfileBuffer::AddEntry(const ProfileBufferEntry& aEntry)
   if (mWritePos == mReadPos) {
     // Keep one slot open.
     mEntries[mReadPos] = ProfileBufferEntry();
-    mReadPos = (mReadPos + 1) % mEntrySize;
+    // Once the buffer has wrapped this runs for every entry the sampler
+    // writes, so avoid the integer division of a modulo.
+    if (++mReadPos == mEntrySize) {
+      mReadPos = 0;
+    }
   }
 }
 
@@ -581,7 +581,12 @@ public:
 
   bool Has() const { return mReadPos != mWritePos; }
   const ProfileBufferEntry& Get() const { return mEntries[mReadPos]; }
-  void Next() { mReadPos = (mReadPos + 1) % mEntrySize; }
+  void Next()
+  {
+    if (++mReadPos == mEntrySize) {
+      mReadPos = 0;
+    }
+  }
 
 private:
   const ProfileBufferEntry* const mEntries;
@@ -318,6 +318,12 @@ CycleCollectedJSContext::ProcessMetastableStateQueue(uint32_t aRecursionDepth)
 {
   MOZ_ASSERT(mJSContext);
   MOZ_RELEASE_ASSERT(!mDoingStableStates);
+
+  // This runs after every microtask, and the queue is almost always empty.
+  if (mMetastableStateEvents.IsEmpty()) {
+    return;
+  }
+
   mDoingStableStates = true;
 
   nsTArray<RunInMetastableStateData> localQueue = Move(mMetastableStateEvents);
@@ -2100,6 +2100,9 @@ private:
   RefPtr<nsCycleCollectorLogger> mLogger;
   bool mMergeZones;
   nsAutoPtr<NodePool::Enumerator> mCurrNode;
+  // Number of edges added while traversing the current node, used to charge
+  // nodes with many children more budget.
+  uint32_t mNoteChildCount;
 
 public:
   CCGraphBuilder(CCGraph& aGraph,
@@ -2181,6 +2184,7 @@ private:
       return;
     }
     mEdgeBuilder.Add(childPi);
+    ++mNoteChildCount;
     if (mLogger) {
       mLogger->NoteEdge((uint64_t)aChild, aEdgeName.get());
     }
@@ -2213,6 +2217,7 @@ CCGraphBuilder::CCGraphBuilder(CCGraph& aGraph,
   , mJSZoneParticipant(nullptr)
   , mLogger(aLogger)
   , mMergeZones(aMergeZones)
+  , mNoteChildCount(0)
 {
   if (aCCRuntime) {
     mJSParticipant = aCCRuntime->GCThingParticipant();
@@ -2292,6 +2297,11 @@ CCGraphBuilder::BuildGraph(SliceBudget& aBudget)
 {
   const intptr_t kNumNodesBetweenTimeChecks = 1000;
   const intptr_t kStep = SliceBudget::CounterReset / kNumNodesBetweenTimeChecks;
+  // Traversing a node is charged one step, plus one step for every
+  // kNumEdgesPerStep children it has. Without this, a run of nodes with huge
+  // numbers of children (large JS arrays, DOM nodes with many children) could
+  // go a long way past the budget before the next time check.
+  const uint32_t kNumEdgesPerStep = 8;
 
   MOZ_ASSERT(mCurrNode);
 
@@ -2307,6 +2317,7 @@ CCGraphBuilder::BuildGraph(SliceBudget& aBudget)
     // firstChild() that may be read by a prior non-deleted neighbor.
     SetFirstChild();
 
+    mNoteChildCount = 0;
     if (pi->mParticipant) {
       nsresult rv = pi->mParticipant->TraverseNativeAndJS(pi->mPointer, *this);
       MOZ_RELEASE_ASSERT(!NS_FAILED(rv), "Cycle collector Traverse method failed");
@@ -2316,7 +2327,7 @@ CCGraphBuilder::BuildGraph(SliceBudget& aBudget)
       SetLastChild();
     }
 
-    aBudget.step(kStep);
+    aBudget.step(kStep * (1 + mNoteChildCount / kNumEdgesPerStep));
   }
 
   if (!mCurrNode->IsDone()) {
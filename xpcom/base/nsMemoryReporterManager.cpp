@@ -34,6 +34,9 @@
 #include "mozilla/dom/ContentParent.h"
 #include "mozilla/gfx/GPUProcessManager.h"
 #include "mozilla/ipc/FileDescriptorUtils.h"
+#include "prsystem.h"
+
+#include <algorithm>
 
 #ifdef XP_WIN
 #include <process.h>
@@ -1633,6 +1636,22 @@ nsMemoryReporterManager::GetReports(
                             /* DMDident = */ EmptyString());
 }
 
+/* static */ uint32_t
+nsMemoryReporterManager::DefaultReportConcurrency()
+{
+  // Child processes do their reporting on their own main threads, so letting a
+  // few of them run at once cuts the wall-clock time of a full report without
+  // making any one of them jankier. Keep a couple of cores free for the parent
+  // and the content the user is interacting with, and cap it so the transient
+  // memory used by in-flight reports stays bounded.
+  static const int32_t kMaxDefaultConcurrency = 4;
+  int32_t cpus = PR_GetNumberOfProcessors();
+  if (cpus <= 2) {
+    return 1;
+  }
+  return std::min(cpus - 2, kMaxDefaultConcurrency);
+}
+
 NS_IMETHODIMP
 nsMemoryReporterManager::GetReportsExtended(
   nsIHandleReportCallback* aHandleReport,
@@ -1663,7 +1682,8 @@ nsMemoryReporterManager::GetReportsExtended(
 
   MEMORY_REPORTING_LOG("GetReports (gen=%u)\n", generation);
 
-  uint32_t concurrency = Preferences::GetUint("memory.report_concurrency", 1);
+  uint32_t concurrency = Preferences::GetUint("memory.report_concurrency",
+                                              DefaultReportConcurrency());
   MOZ_ASSERT(concurrency >= 1);
   if (concurrency < 1) {
     concurrency = 1;
@@ -57,7 +57,8 @@ public:
   //   The number of concurrent child process reports is limited by the pref
   //   "memory.report_concurrency" in order to prevent the memory overhead of
   //   memory reporting from causing problems, especially on B2G when swapping
-  //   to compressed RAM; see bug 1154053.
+  //   to compressed RAM; see bug 1154053. When the pref is unset the limit
+  //   scales with the number of cores; see DefaultReportConcurrency().
   //
   // - HandleChildReport() is called (asynchronously) once per child process
   //   reporter callback.
@@ -198,6 +199,10 @@ private:
                         nsISupports* aHandleReportData,
                         bool aAnonymize);
 
+  // The child process concurrency limit used when "memory.report_concurrency"
+  // is not set.
+  static uint32_t DefaultReportConcurrency();
+
   static void TimeoutCallback(nsITimer* aTimer, void* aData);
   // Note: this timeout needs to be long enough to allow for the
   // possibility of DMD reports and/or running on a low-end phone.
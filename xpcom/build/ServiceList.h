@@ -43,6 +43,8 @@ MOZ_SERVICE(URIClassifier, nsIURIClassifier,
             "@mozilla.org/uriclassifierservice");
 MOZ_SERVICE(ActivityDistributor, nsIHttpActivityDistributor,
             "@mozilla.org/network/http-activity-distributor;1");
+MOZ_SERVICE(ThirdPartyUtil, mozIThirdPartyUtil,
+            "@mozilla.org/thirdpartyutil;1");
 
 #ifdef MOZ_USE_NAMESPACE
 namespace mozilla {
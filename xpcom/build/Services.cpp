@@ -30,6 +30,7 @@
 #include "nsIAsyncShutdown.h"
 #include "nsIUUIDGenerator.h"
 #include "nsIGfxInfo.h"
+#include "mozIThirdPartyUtil.h"
 
 using namespace mozilla;
 using namespace mozilla::services;
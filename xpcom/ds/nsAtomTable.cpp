@@ -40,8 +40,10 @@
 //   Atoms ignore all AddRef/Release calls, which ensures they stay alive until
 //   |gAtomTable| itself is destroyed whereupon they are explicitly deleted.
 //
-// Note that gAtomTable is used on multiple threads, and callers must acquire
-// gAtomTableLock before touching it.
+// Note that gAtomTable is used on multiple threads. It is split into
+// kNumAtomSubTables sub-tables, selected by the atom's hash, each with its own
+// lock, so that threads atomizing different strings rarely contend. Callers
+// must acquire a sub-table's lock before touching that sub-table.
 
 using namespace mozilla;
 
@@ -125,8 +127,8 @@ public:
     Shutdown,
   };
 
-  static void GCAtomTableLocked(const MutexAutoLock& aProofOfLock,
-                                GCKind aKind);
+  // Locks each sub-table in turn. Must be called on the main thread.
+  static void GCAtomTable(GCKind aKind);
 
 private:
   // This constructor is for dynamic Atoms.
@@ -194,7 +196,7 @@ private:
 public:
   // We don't need a virtual destructor because we always delete via an Atom*
   // pointer (in AtomTableClearEntry() for static Atoms, and in
-  // GCAtomTableLocked() for dynamic Atoms), not an nsIAtom* pointer.
+  // GCAtomTable() for dynamic Atoms), not an nsIAtom* pointer.
   ~Atom() {
     if (IsDynamicAtom()) {
       nsStringBuffer::FromData(mString)->Release();
@@ -280,12 +282,13 @@ nsIAtom::Release()
 //----------------------------------------------------------------------
 
 /**
- * The shared hash table for atom lookups.
+ * The shared hash table for atom lookups, split into independently locked
+ * sub-tables. An atom lives in the sub-table selected by its hash.
  *
- * Callers must hold gAtomTableLock before manipulating the table.
+ * Callers must hold a sub-table's mLock before manipulating its mTable.
  */
-static PLDHashTable* gAtomTable;
-static Mutex* gAtomTableLock;
+struct AtomSubTable;
+static AtomSubTable* gAtomTable;
 
 struct AtomTableKey
 {
@@ -397,6 +400,50 @@ static const PLDHashTableOps AtomTableOps = {
   AtomTableInitEntry
 };
 
+// The atom table very quickly gets 10,000+ entries in it (or even 100,000+).
+// But choosing the best initial length has some subtleties: we add ~2700
+// static atoms to the table at start-up, and then we start adding and removing
+// dynamic atoms. If we make the table too big to start with, when the first
+// dynamic atom gets removed the load factor will be < 25% and so we will
+// shrink it to 4096 entries.
+//
+// By choosing an initial length of 4096, we get an initial capacity of 8192.
+// That's the biggest initial capacity that will let us be > 25% full when the
+// first dynamic atom is removed (when the count is ~2700), thus avoiding any
+// shrinking. The same reasoning applies to each sub-table, which gets an equal
+// share of both the initial length and the static atoms.
+#define ATOM_HASHTABLE_INITIAL_LENGTH  4096
+
+// Must be a power of two.
+static const uint32_t kNumAtomSubTables = 128;
+
+struct AtomSubTable
+{
+  AtomSubTable()
+    : mLock("Atom Sub-Table Lock")
+    , mTable(&AtomTableOps, sizeof(AtomTableEntry),
+             ATOM_HASHTABLE_INITIAL_LENGTH / kNumAtomSubTables)
+  {}
+
+  AtomTableEntry* Add(AtomTableKey& aKey)
+  {
+    mLock.AssertCurrentThreadOwns();
+    // This is an infallible add.
+    return static_cast<AtomTableEntry*>(mTable.Add(&aKey));
+  }
+
+  Mutex mLock;
+  PLDHashTable mTable;
+};
+
+static inline AtomSubTable&
+SelectAtomSubTable(const AtomTableKey& aKey)
+{
+  // PLDHashTable indexes with the high bits of the (scrambled) hash, so use
+  // the low bits to pick the sub-table.
+  return gAtomTable[aKey.mHash & (kNumAtomSubTables - 1)];
+}
+
 //----------------------------------------------------------------------
 
 #define RECENTLY_USED_MAIN_THREAD_ATOM_CACHE_SIZE 31
@@ -407,13 +454,12 @@ void
 Atom::GCAtomTable()
 {
   if (NS_IsMainThread()) {
-    MutexAutoLock lock(*gAtomTableLock);
-    GCAtomTableLocked(lock, GCKind::RegularOperation);
+    GCAtomTable(GCKind::RegularOperation);
   }
 }
 
 void
-Atom::GCAtomTableLocked(const MutexAutoLock& aProofOfLock, GCKind aKind)
+Atom::GCAtomTable(GCKind aKind)
 {
   MOZ_ASSERT(NS_IsMainThread());
   for (uint32_t i = 0; i < RECENTLY_USED_MAIN_THREAD_ATOM_CACHE_SIZE; ++i) {
@@ -423,37 +469,40 @@ Atom::GCAtomTableLocked(const MutexAutoLock& aProofOfLock, GCKind aKind)
   uint32_t removedCount = 0; // Use a non-atomic temporary for cheaper increments.
   nsAutoCString nonZeroRefcountAtoms;
   uint32_t nonZeroRefcountAtomsCount = 0;
-  for (auto i = gAtomTable->Iter(); !i.Done(); i.Next()) {
-    auto entry = static_cast<AtomTableEntry*>(i.Get());
-    if (entry->mAtom->IsStaticAtom()) {
-      continue;
-    }
+  for (uint32_t t = 0; t < kNumAtomSubTables; ++t) {
+    AtomSubTable& table = gAtomTable[t];
+    MutexAutoLock lock(table.mLock);
+    for (auto i = table.mTable.Iter(); !i.Done(); i.Next()) {
+      auto entry = static_cast<AtomTableEntry*>(i.Get());
+      if (entry->mAtom->IsStaticAtom()) {
+        continue;
+      }
 
-    Atom* atom = entry->mAtom;
-    if (atom->mRefCnt == 0) {
-      i.Remove();
-      delete atom;
-      ++removedCount;
-    }
+      Atom* atom = entry->mAtom;
+      if (atom->mRefCnt == 0) {
+        i.Remove();
+        delete atom;
+        ++removedCount;
+      }
 #ifdef NS_FREE_PERMANENT_DATA
-    else if (aKind == GCKind::Shutdown && PR_GetEnv("XPCOM_MEM_BLOAT_LOG")) {
-      // Only report leaking atoms in leak-checking builds in a run
-      // where we are checking for leaks, during shutdown. If
-      // something is anomalous, then we'll assert later in this
-      // function.
-      nsAutoCString name;
-      atom->ToUTF8String(name);
-      if (nonZeroRefcountAtomsCount == 0) {
-        nonZeroRefcountAtoms = name;
-      } else if (nonZeroRefcountAtomsCount < 20) {
-        nonZeroRefcountAtoms += NS_LITERAL_CSTRING(",") + name;
-      } else if (nonZeroRefcountAtomsCount == 20) {
-        nonZeroRefcountAtoms += NS_LITERAL_CSTRING(",...");
+      else if (aKind == GCKind::Shutdown && PR_GetEnv("XPCOM_MEM_BLOAT_LOG")) {
+        // Only report leaking atoms in leak-checking builds in a run
+        // where we are checking for leaks, during shutdown. If
+        // something is anomalous, then we'll assert later in this
+        // function.
+        nsAutoCString name;
+        atom->ToUTF8String(name);
+        if (nonZeroRefcountAtomsCount == 0) {
+          nonZeroRefcountAtoms = name;
+        } else if (nonZeroRefcountAtomsCount < 20) {
+          nonZeroRefcountAtoms += NS_LITERAL_CSTRING(",") + name;
+        } else if (nonZeroRefcountAtomsCount == 20) {
+          nonZeroRefcountAtoms += NS_LITERAL_CSTRING(",...");
+        }
+        nonZeroRefcountAtomsCount++;
       }
-      nonZeroRefcountAtomsCount++;
-    }
 #endif
-
+    }
   }
   if (nonZeroRefcountAtomsCount) {
     nsPrintfCString msg("%d dynamic atom(s) with non-zero refcount: %s",
@@ -463,15 +512,15 @@ Atom::GCAtomTableLocked(const MutexAutoLock& aProofOfLock, GCKind aKind)
 
   // We would like to assert that gUnusedAtomCount matches the number of atoms
   // we found in the table which we removed. During the course of this function,
-  // the atom table is locked, but this lock is not acquired for AddRef() and
-  // Release() calls. This means we might see a gUnusedAtomCount value in
-  // between, say, AddRef() incrementing mRefCnt and it decrementing
-  // gUnusedAtomCount. So, we don't bother asserting that there are no unused
-  // atoms at the end of a regular GC. But we can (and do) assert thist just
-  // after the last GC at shutdown.
+  // each sub-table is locked while it is swept, but these locks are not
+  // acquired for AddRef() and Release() calls. This means we might see a
+  // gUnusedAtomCount value in between, say, AddRef() incrementing mRefCnt and
+  // it decrementing gUnusedAtomCount. So, we don't bother asserting that there
+  // are no unused atoms at the end of a regular GC. But we can (and do) assert
+  // thist just after the last GC at shutdown.
   //
   // Note that, barring refcounting bugs, an atom can only go from a zero
-  // refcount to a non-zero refcount while the atom table lock is held, so
+  // refcount to a non-zero refcount while its sub-table's lock is held, so
   // so we won't try to resurrect a zero refcount atom while trying to delete
   // it.
 
@@ -555,31 +604,29 @@ public:
 typedef nsTHashtable<StaticAtomEntry> StaticAtomTable;
 static StaticAtomTable* gStaticAtomTable = nullptr;
 
+// gStaticAtomTable only ever gets the ~2700 static atoms and never has entries
+// removed. An initial length of 2048 gives an initial capacity of 4096, which is
+// what the table would grow to anyway, without the dozen or so rehashes it'd go
+// through on the way there from the default length.
+#define STATIC_ATOM_HASHTABLE_INITIAL_LENGTH  2048
+
 /**
  * Whether it is still OK to add atoms to gStaticAtomTable.
  */
 static bool gStaticAtomTableSealed = false;
 
-// The atom table very quickly gets 10,000+ entries in it (or even 100,000+).
-// But choosing the best initial length has some subtleties: we add ~2700
-// static atoms to the table at start-up, and then we start adding and removing
-// dynamic atoms. If we make the table too big to start with, when the first
-// dynamic atom gets removed the load factor will be < 25% and so we will
-// shrink it to 4096 entries.
-//
-// By choosing an initial length of 4096, we get an initial capacity of 8192.
-// That's the biggest initial capacity that will let us be > 25% full when the
-// first dynamic atom is removed (when the count is ~2700), thus avoiding any
-// shrinking.
-#define ATOM_HASHTABLE_INITIAL_LENGTH  4096
-
 void
 NS_InitAtomTable()
 {
   MOZ_ASSERT(!gAtomTable);
-  gAtomTable = new PLDHashTable(&AtomTableOps, sizeof(AtomTableEntry),
-                                ATOM_HASHTABLE_INITIAL_LENGTH);
-  gAtomTableLock = new Mutex("Atom Table Lock");
+  // Construct the sub-tables in a plain malloc block rather than with new[],
+  // which would put an array cookie in front of them and leave gAtomTable
+  // pointing into the middle of the block it reports as its size.
+  gAtomTable = static_cast<AtomSubTable*>(
+    moz_xmalloc(sizeof(AtomSubTable) * kNumAtomSubTables));
+  for (uint32_t t = 0; t < kNumAtomSubTables; ++t) {
+    new (&gAtomTable[t]) AtomSubTable();
+  }
 
   // Bug 1340710 has caused us to generate an empty atom at arbitrary times
   // after startup.  If we end up creating one before nsGkAtoms::_empty is
@@ -608,27 +655,29 @@ NS_ShutdownAtomTable()
 #ifdef NS_FREE_PERMANENT_DATA
   // Do a final GC to satisfy leak checking. We skip this step in release
   // builds.
-  {
-    MutexAutoLock lock(*gAtomTableLock);
-    Atom::GCAtomTableLocked(lock, Atom::GCKind::Shutdown);
-  }
+  Atom::GCAtomTable(Atom::GCKind::Shutdown);
 #endif
 
-  delete gAtomTable;
+  for (uint32_t t = 0; t < kNumAtomSubTables; ++t) {
+    gAtomTable[t].~AtomSubTable();
+  }
+  free(gAtomTable);
   gAtomTable = nullptr;
-  delete gAtomTableLock;
-  gAtomTableLock = nullptr;
 }
 
 void
 NS_SizeOfAtomTablesIncludingThis(MallocSizeOf aMallocSizeOf,
                                  size_t* aMain, size_t* aStatic)
 {
-  MutexAutoLock lock(*gAtomTableLock);
-  *aMain = gAtomTable->ShallowSizeOfIncludingThis(aMallocSizeOf);
-  for (auto iter = gAtomTable->Iter(); !iter.Done(); iter.Next()) {
-    auto entry = static_cast<AtomTableEntry*>(iter.Get());
-    *aMain += entry->mAtom->SizeOfIncludingThis(aMallocSizeOf);
+  *aMain = aMallocSizeOf(gAtomTable);
+  for (uint32_t t = 0; t < kNumAtomSubTables; ++t) {
+    AtomSubTable& table = gAtomTable[t];
+    MutexAutoLock lock(table.mLock);
+    *aMain += table.mTable.ShallowSizeOfExcludingThis(aMallocSizeOf);
+    for (auto iter = table.mTable.Iter(); !iter.Done(); iter.Next()) {
+      auto entry = static_cast<AtomTableEntry*>(iter.Get());
+      *aMain += entry->mAtom->SizeOfIncludingThis(aMallocSizeOf);
+    }
   }
 
   // The atoms pointed to by gStaticAtomTable are also pointed to by gAtomTable,
@@ -638,34 +687,17 @@ NS_SizeOfAtomTablesIncludingThis(MallocSizeOf aMallocSizeOf,
            : 0;
 }
 
-static inline AtomTableEntry*
-GetAtomHashEntry(const char* aString, uint32_t aLength, uint32_t* aHashOut)
-{
-  gAtomTableLock->AssertCurrentThreadOwns();
-  AtomTableKey key(aString, aLength, aHashOut);
-  // This is an infallible add.
-  return static_cast<AtomTableEntry*>(gAtomTable->Add(&key));
-}
-
-static inline AtomTableEntry*
-GetAtomHashEntry(const char16_t* aString, uint32_t aLength, uint32_t* aHashOut)
-{
-  gAtomTableLock->AssertCurrentThreadOwns();
-  AtomTableKey key(aString, aLength, aHashOut);
-  // This is an infallible add.
-  return static_cast<AtomTableEntry*>(gAtomTable->Add(&key));
-}
-
 void
 RegisterStaticAtoms(const nsStaticAtom* aAtoms, uint32_t aAtomCount)
 {
-  MutexAutoLock lock(*gAtomTableLock);
+  // gStaticAtomTable is not protected by the sub-table locks.
+  MOZ_ASSERT(NS_IsMainThread());
 
   MOZ_RELEASE_ASSERT(!gStaticAtomTableSealed,
                      "Atom table has already been sealed!");
 
   if (!gStaticAtomTable) {
-    gStaticAtomTable = new StaticAtomTable();
+    gStaticAtomTable = new StaticAtomTable(STATIC_ATOM_HASHTABLE_INITIAL_LENGTH);
   }
 
   for (uint32_t i = 0; i < aAtomCount; ++i) {
@@ -677,9 +709,11 @@ RegisterStaticAtoms(const nsStaticAtom* aAtoms, uint32_t aAtomCount)
     uint32_t stringLen = stringBuffer->StorageSize() / sizeof(char16_t) - 1;
 
     uint32_t hash;
-    AtomTableEntry* he =
-      GetAtomHashEntry(static_cast<char16_t*>(stringBuffer->Data()),
-                       stringLen, &hash);
+    AtomTableKey key(static_cast<char16_t*>(stringBuffer->Data()),
+                     stringLen, &hash);
+    AtomSubTable& table = SelectAtomSubTable(key);
+    MutexAutoLock lock(table.mLock);
+    AtomTableEntry* he = table.Add(key);
 
     Atom* atom = he->mAtom;
     if (atom) {
@@ -717,11 +751,11 @@ NS_Atomize(const char* aUTF8String)
 already_AddRefed<nsIAtom>
 NS_Atomize(const nsACString& aUTF8String)
 {
-  MutexAutoLock lock(*gAtomTableLock);
   uint32_t hash;
-  AtomTableEntry* he = GetAtomHashEntry(aUTF8String.Data(),
-                                        aUTF8String.Length(),
-                                        &hash);
+  AtomTableKey key(aUTF8String.Data(), aUTF8String.Length(), &hash);
+  AtomSubTable& table = SelectAtomSubTable(key);
+  MutexAutoLock lock(table.mLock);
+  AtomTableEntry* he = table.Add(key);
 
   if (he->mAtom) {
     nsCOMPtr<nsIAtom> atom = he->mAtom;
@@ -750,11 +784,11 @@ NS_Atomize(const char16_t* aUTF16String)
 already_AddRefed<nsIAtom>
 NS_Atomize(const nsAString& aUTF16String)
 {
-  MutexAutoLock lock(*gAtomTableLock);
   uint32_t hash;
-  AtomTableEntry* he = GetAtomHashEntry(aUTF16String.Data(),
-                                        aUTF16String.Length(),
-                                        &hash);
+  AtomTableKey key(aUTF16String.Data(), aUTF16String.Length(), &hash);
+  AtomSubTable& table = SelectAtomSubTable(key);
+  MutexAutoLock lock(table.mLock);
+  AtomTableEntry* he = table.Add(key);
 
   if (he->mAtom) {
     nsCOMPtr<nsIAtom> atom = he->mAtom;
@@ -787,8 +821,9 @@ NS_AtomizeMainThread(const nsAString& aUTF16String)
     }
   }
 
-  MutexAutoLock lock(*gAtomTableLock);
-  AtomTableEntry* he = static_cast<AtomTableEntry*>(gAtomTable->Add(&key));
+  AtomSubTable& table = SelectAtomSubTable(key);
+  MutexAutoLock lock(table.mLock);
+  AtomTableEntry* he = table.Add(key);
 
   if (he->mAtom) {
     retVal = he->mAtom;
@@ -806,8 +841,13 @@ nsrefcnt
 NS_GetNumberOfAtoms(void)
 {
   Atom::GCAtomTable(); // Trigger a GC so that we return a deterministic result.
-  MutexAutoLock lock(*gAtomTableLock);
-  return gAtomTable->EntryCount();
+  nsrefcnt count = 0;
+  for (uint32_t t = 0; t < kNumAtomSubTables; ++t) {
+    AtomSubTable& table = gAtomTable[t];
+    MutexAutoLock lock(table.mLock);
+    count += table.mTable.EntryCount();
+  }
+  return count;
 }
 
 nsIAtom*
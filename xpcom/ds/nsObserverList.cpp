@@ -6,11 +6,20 @@
 
 #include "nsObserverList.h"
 
+#include "mozilla/Logging.h"
+#include "mozilla/TimeStamp.h"
 #include "nsAutoPtr.h"
 #include "nsCOMArray.h"
 #include "nsISimpleEnumerator.h"
 #include "xpcpublic.h"
 
+using namespace mozilla;
+
+// Shares the "ObserverService" log module with nsObserverService.cpp. At
+// Verbose level, the time spent in each observer is logged so that the
+// expensive ones for a given topic can be found.
+static LazyLogModule sObserverListLog("ObserverService");
+
 nsresult
 nsObserverList::AddObserver(nsIObserver* anObserver, bool ownsWeak)
 {
@@ -71,7 +80,10 @@ nsObserverList::FillObserverArray(nsCOMArray<nsIObserver>& aArray)
 {
   aArray.SetCapacity(mObservers.Length());
 
-  nsTArray<ObserverRef> observers(mObservers);
+  // Most topics have a handful of observers; don't hit the heap for the
+  // snapshot on every notification.
+  AutoTArray<ObserverRef, 16> observers;
+  observers.AppendElements(mObservers);
 
   for (int32_t i = observers.Length() - 1; i >= 0; --i) {
     if (observers[i].isWeakRef) {
@@ -108,6 +120,17 @@ nsObserverList::NotifyObservers(nsISupports* aSubject,
   nsCOMArray<nsIObserver> observers;
   FillObserverArray(observers);
 
+  if (MOZ_UNLIKELY(MOZ_LOG_TEST(sObserverListLog, LogLevel::Verbose))) {
+    for (int32_t i = 0; i < observers.Count(); ++i) {
+      TimeStamp start = TimeStamp::Now();
+      observers[i]->Observe(aSubject, aTopic, someData);
+      MOZ_LOG(sObserverListLog, LogLevel::Verbose,
+              ("%s: observer %p took %.3fms", aTopic, observers[i],
+               (TimeStamp::Now() - start).ToMilliseconds()));
+    }
+    return;
+  }
+
   for (int32_t i = 0; i < observers.Count(); ++i) {
     observers[i]->Observe(aSubject, aTopic, someData);
   }
@@ -142,6 +142,11 @@ nsTArray_base<Alloc, Copy>::EnsureCapacity(size_type aCapacity,
     header->mIsAutoArray = 0;
     mHdr = header;
 
+#ifdef MOZ_TARRAY_ALLOCATION_STATS
+    nsTArray_RecordAllocation(__builtin_return_address(0),
+                              nsTArrayAllocationKind::Initial, aCapacity);
+#endif
+
     return ActualAlloc::SuccessResult();
   }
 
@@ -165,6 +170,14 @@ nsTArray_base<Alloc, Copy>::EnsureCapacity(size_type aCapacity,
     bytesToAlloc = mozilla::RoundUpPow2(reqSize);
   }
 
+#ifdef MOZ_TARRAY_ALLOCATION_STATS
+  nsTArray_RecordAllocation(__builtin_return_address(0),
+                            UsesAutoArrayBuffer()
+                              ? nsTArrayAllocationKind::AutoSpill
+                              : nsTArrayAllocationKind::Grow,
+                            aCapacity);
+#endif
+
   Header* header;
   if (UsesAutoArrayBuffer() || !Copy::allowRealloc) {
     // Malloc() and copy
@@ -11,6 +11,12 @@
 #include "mozilla/CheckedInt.h"
 #include "mozilla/IntegerPrintfMacros.h"
 
+#ifdef MOZ_TARRAY_ALLOCATION_STATS
+#include <stdlib.h>
+#include "mozilla/Atomics.h"
+#include "mozilla/HashFunctions.h"
+#endif
+
 nsTArrayHeader nsTArrayHeader::sEmptyHdr = { 0, 0, 0 };
 
 bool
@@ -27,3 +33,100 @@ InvalidArrayIndex_CRASH(size_t aIndex, size_t aLength)
     "ElementAt(aIndex = %" PRIu64 ", aLength = %" PRIu64 ")",
     static_cast<uint64_t>(aIndex), static_cast<uint64_t>(aLength));
 }
+
+#ifdef MOZ_TARRAY_ALLOCATION_STATS
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "MOZ_TARRAY_ALLOCATION_STATS requires __builtin_return_address"
+#endif
+
+namespace {
+
+using mozilla::Atomic;
+
+struct AllocationSite
+{
+  Atomic<const void*> mCaller;
+  Atomic<uint32_t> mInitial;
+  Atomic<uint32_t> mInitialSingleElement;
+  Atomic<uint32_t> mAutoSpills;
+  Atomic<uint32_t> mGrowths;
+};
+
+// A fixed-size, insert-only, open-addressed table of call sites. It can't
+// use any container that allocates with nsTArray, and must be usable from any
+// thread without locking.
+const size_t kNumAllocationSites = 4096;
+const size_t kMaxAllocationSiteProbes = 32;
+AllocationSite sAllocationSites[kNumAllocationSites];
+Atomic<uint32_t> sUnrecordedAllocations;
+Atomic<bool> sAllocationStatsRegistered;
+
+void
+DumpAllocationStats()
+{
+  printf_stderr("nsTArray allocations by call site "
+                "(initial, initial with capacity 1, auto spills, growths):\n");
+  for (AllocationSite& site : sAllocationSites) {
+    if (!site.mCaller) {
+      continue;
+    }
+    printf_stderr("  %p %u %u %u %u\n", static_cast<const void*>(site.mCaller),
+                  uint32_t(site.mInitial), uint32_t(site.mInitialSingleElement),
+                  uint32_t(site.mAutoSpills), uint32_t(site.mGrowths));
+  }
+  if (sUnrecordedAllocations) {
+    printf_stderr("  %u allocations from unrecorded call sites\n",
+                  uint32_t(sUnrecordedAllocations));
+  }
+}
+
+AllocationSite*
+LookupAllocationSite(const void* aCaller)
+{
+  size_t index = mozilla::HashGeneric(aCaller) % kNumAllocationSites;
+  for (size_t i = 0; i < kMaxAllocationSiteProbes; i++) {
+    AllocationSite& site = sAllocationSites[(index + i) % kNumAllocationSites];
+    if (site.mCaller == aCaller ||
+        site.mCaller.compareExchange(nullptr, aCaller) ||
+        site.mCaller == aCaller) {
+      return &site;
+    }
+  }
+  return nullptr;
+}
+
+} // namespace
+
+void
+nsTArray_RecordAllocation(const void* aCaller, nsTArrayAllocationKind aKind,
+                          size_t aCapacity)
+{
+  if (!sAllocationStatsRegistered &&
+      sAllocationStatsRegistered.compareExchange(false, true)) {
+    atexit(DumpAllocationStats);
+  }
+
+  AllocationSite* site = LookupAllocationSite(aCaller);
+  if (!site) {
+    sUnrecordedAllocations++;
+    return;
+  }
+
+  switch (aKind) {
+    case nsTArrayAllocationKind::Initial:
+      site->mInitial++;
+      if (aCapacity == 1) {
+        site->mInitialSingleElement++;
+      }
+      break;
+    case nsTArrayAllocationKind::AutoSpill:
+      site->mAutoSpills++;
+      break;
+    case nsTArrayAllocationKind::Grow:
+      site->mGrowths++;
+      break;
+  }
+}
+
+#endif // MOZ_TARRAY_ALLOCATION_STATS
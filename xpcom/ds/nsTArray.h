@@ -369,6 +369,27 @@ extern "C" void Gecko_ClearPODTArray(void* aArray,
 MOZ_NORETURN MOZ_COLD void
 InvalidArrayIndex_CRASH(size_t aIndex, size_t aLength);
 
+#ifdef MOZ_TARRAY_ALLOCATION_STATS
+// Allocation instrumentation for nsTArray_base::EnsureCapacity, enabled by
+// building with -DMOZ_TARRAY_ALLOCATION_STATS. Heap allocations are counted
+// per calling code address and dumped to stderr at exit, so that arrays that
+// routinely spill out of their AutoTArray buffer, or that only ever hold a
+// single element, can be found and given a suitable inline capacity.
+enum class nsTArrayAllocationKind
+{
+  // First heap allocation of an array that had no storage.
+  Initial,
+  // First heap allocation of an array using its AutoTArray buffer.
+  AutoSpill,
+  // Growth of an existing heap allocation.
+  Grow,
+};
+
+void
+nsTArray_RecordAllocation(const void* aCaller, nsTArrayAllocationKind aKind,
+                          size_t aCapacity);
+#endif
+
 //
 // This class serves as a base class for nsTArray.  It shouldn't be used
 // directly.  It holds common implementation code that does not depend on the
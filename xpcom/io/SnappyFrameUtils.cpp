@@ -132,6 +132,16 @@ SnappyFrameUtils::WriteCompressedData(char* aDest, size_t aDestLength,
   size_t compressedLength;
   snappy::RawCompress(aData, aDataLength, aDest + offset, &compressedLength);
 
+  // Incompressible input (media, already-compressed images, ...) comes out of
+  // snappy slightly larger than it went in.  Store it as an uncompressed data
+  // chunk instead, which the framing format allows and which makes reading it
+  // back a plain copy.
+  if (compressedLength >= aDataLength) {
+    WriteChunkType(aDest, UncompressedData);
+    memcpy(aDest + offset, aData, aDataLength);
+    compressedLength = aDataLength;
+  }
+
   // Go back and write the data length.
   size_t dataLength = compressedLength + kCRCLength;
   WriteUInt24(aDest + lengthOffset, dataLength);
@@ -172,6 +182,10 @@ SnappyFrameUtils::ParseData(char* aDest, size_t aDestLength,
       return ParseCompressedData(aDest, aDestLength, aData, aDataLength,
                                  aBytesWrittenOut, aBytesReadOut);
 
+    case UncompressedData:
+      return ParseUncompressedData(aDest, aDestLength, aData, aDataLength,
+                                   aBytesWrittenOut, aBytesReadOut);
+
     // TODO: support other snappy chunk types
     default:
       MOZ_ASSERT_UNREACHABLE("Unsupported snappy framing chunk type.");
@@ -244,6 +258,42 @@ SnappyFrameUtils::ParseCompressedData(char* aDest, size_t aDestLength,
   return NS_OK;
 }
 
+// static
+nsresult
+SnappyFrameUtils::ParseUncompressedData(char* aDest, size_t aDestLength,
+                                        const char* aData, size_t aDataLength,
+                                        size_t* aBytesWrittenOut,
+                                        size_t* aBytesReadOut)
+{
+  *aBytesWrittenOut = 0;
+  *aBytesReadOut = 0;
+
+  if (NS_WARN_IF(aDataLength < kCRCLength)) {
+    return NS_ERROR_CORRUPTED_CONTENT;
+  }
+
+  uint32_t readCrc = LittleEndian::readUint32(aData);
+  size_t uncompressedLength = aDataLength - kCRCLength;
+
+  if (NS_WARN_IF(aDestLength < uncompressedLength)) {
+    return NS_ERROR_NOT_AVAILABLE;
+  }
+
+  memcpy(aDest, aData + kCRCLength, uncompressedLength);
+
+  uint32_t crc = ComputeCrc32c(~0, reinterpret_cast<const unsigned char*>(aDest),
+                               uncompressedLength);
+  uint32_t maskedCrc = MaskChecksum(crc);
+  if (NS_WARN_IF(readCrc != maskedCrc)) {
+    return NS_ERROR_CORRUPTED_CONTENT;
+  }
+
+  *aBytesWrittenOut = uncompressedLength;
+  *aBytesReadOut = aDataLength;
+
+  return NS_OK;
+}
+
 // static
 size_t
 SnappyFrameUtils::MaxCompressedBufferLength(size_t aSourceLength)
@@ -71,6 +71,11 @@ public:
                       const char* aData, size_t aDataLength,
                       size_t* aBytesWrittenOut, size_t* aBytesReadOut);
 
+  static nsresult
+  ParseUncompressedData(char* aDest, size_t aDestLength,
+                        const char* aData, size_t aDataLength,
+                        size_t* aBytesWrittenOut, size_t* aBytesReadOut);
+
   static size_t
   MaxCompressedBufferLength(size_t aSourceLength);
 
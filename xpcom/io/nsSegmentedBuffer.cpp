@@ -64,9 +64,13 @@ nsSegmentedBuffer::AppendNewSegment()
     mSegmentArrayCount = newArraySize;
   }
 
-  char* seg = (char*)malloc(mSegmentSize);
+  char* seg = mSpareSegment;
+  mSpareSegment = nullptr;
   if (!seg) {
-    return nullptr;
+    seg = (char*)malloc(mSegmentSize);
+    if (!seg) {
+      return nullptr;
+    }
   }
   mSegmentArray[mLastSegmentIndex] = seg;
   mLastSegmentIndex = ModSegArraySize(mLastSegmentIndex + 1);
@@ -77,7 +81,11 @@ bool
 nsSegmentedBuffer::DeleteFirstSegment()
 {
   NS_ASSERTION(mSegmentArray[mFirstSegmentIndex] != nullptr, "deleting bad segment");
-  free(mSegmentArray[mFirstSegmentIndex]);
+  if (!mSpareSegment && !mSegmentResized) {
+    mSpareSegment = mSegmentArray[mFirstSegmentIndex];
+  } else {
+    free(mSegmentArray[mFirstSegmentIndex]);
+  }
   mSegmentArray[mFirstSegmentIndex] = nullptr;
   int32_t last = ModSegArraySize(mLastSegmentIndex - 1);
   if (mFirstSegmentIndex == last) {
@@ -108,6 +116,7 @@ nsSegmentedBuffer::ReallocLastSegment(size_t aNewSize)
   char* newSegment = (char*)realloc(mSegmentArray[last], aNewSize);
   if (newSegment) {
     mSegmentArray[last] = newSegment;
+    mSegmentResized = true;
     return true;
   }
   return false;
@@ -125,6 +134,8 @@ nsSegmentedBuffer::Empty()
     free(mSegmentArray);
     mSegmentArray = nullptr;
   }
+  free(mSpareSegment);
+  mSpareSegment = nullptr;
   mSegmentArrayCount = NS_SEGMENTARRAY_INITIAL_COUNT;
   mFirstSegmentIndex = mLastSegmentIndex = 0;
 }
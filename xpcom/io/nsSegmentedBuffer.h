@@ -19,6 +19,8 @@ public:
     , mSegmentArrayCount(0)
     , mFirstSegmentIndex(0)
     , mLastSegmentIndex(0)
+    , mSpareSegment(nullptr)
+    , mSegmentResized(false)
   {
   }
 
@@ -94,6 +96,13 @@ protected:
   uint32_t            mSegmentArrayCount;
   int32_t             mFirstSegmentIndex;
   int32_t             mLastSegmentIndex;
+
+  // The most recently consumed first segment, kept around so that a buffer
+  // being drained and refilled (such as a pipe) doesn't free and malloc a
+  // segment each time. Never used once a segment has been resized, since we
+  // then can't tell a full-sized segment from a shrunken one.
+  char*               mSpareSegment;
+  bool                mSegmentResized;
 };
 
 // NS_SEGMENTARRAY_INITIAL_SIZE: This number needs to start out as a
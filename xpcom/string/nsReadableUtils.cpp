@@ -59,6 +59,44 @@ FirstNonASCIIUnvectorized(const char16_t* aBegin, const char16_t* aEnd)
   return -1;
 }
 
+/**
+ * Fallback implementation for finding the first non-ASCII character in a
+ * UTF-8 string.
+ */
+static inline int32_t
+FirstNonASCIIUnvectorized(const char* aBegin, const char* aEnd)
+{
+  const size_t kMask = mozilla::NonASCIIByteMask();
+  const uintptr_t kAlignMask = sizeof(size_t) - 1;
+
+  const char* idx = aBegin;
+
+  // Align ourselves to a word boundary.
+  for (; idx != aEnd && ((uintptr_t(idx) & kAlignMask) != 0); idx++) {
+    if (!IsASCII(*idx)) {
+      return idx - aBegin;
+    }
+  }
+
+  // Check one word at a time.
+  const char* wordWalkEnd = mozilla::aligned(aEnd, kAlignMask);
+  for (; idx < wordWalkEnd; idx += sizeof(size_t)) {
+    const size_t word = *reinterpret_cast<const size_t*>(idx);
+    if (word & kMask) {
+      return idx - aBegin;
+    }
+  }
+
+  // Take care of the remainder one character at a time.
+  for (; idx != aEnd; idx++) {
+    if (!IsASCII(*idx)) {
+      return idx - aBegin;
+    }
+  }
+
+  return -1;
+}
+
 /*
  * This function returns -1 if all characters in str are ASCII characters.
  * Otherwise, it returns a value less than or equal to the index of the first
@@ -78,6 +116,22 @@ FirstNonASCII(const char16_t* aBegin, const char16_t* aEnd)
   return FirstNonASCIIUnvectorized(aBegin, aEnd);
 }
 
+/*
+ * UTF-8 version of the above, with the same guarantees about the return
+ * value.
+ */
+static inline int32_t
+FirstNonASCII(const char* aBegin, const char* aEnd)
+{
+#ifdef MOZILLA_MAY_SUPPORT_SSE2
+  if (mozilla::supports_sse2()) {
+    return mozilla::SSE2::FirstNonASCII(aBegin, aEnd);
+  }
+#endif
+
+  return FirstNonASCIIUnvectorized(aBegin, aEnd);
+}
+
 void
 LossyCopyUTF16toASCII(const nsAString& aSource, nsACString& aDest)
 {
@@ -350,12 +404,32 @@ bool
 AppendUTF8toUTF16(const nsACString& aSource, nsAString& aDest,
                   const mozilla::fallible_t& aFallible)
 {
+  // As in AppendUTF16toUTF8, only look for an ASCII prefix in strings long
+  // enough for it to pay off.
+  const nsACString::size_type kFastPathMinLength = 16;
+
+  int32_t firstNonASCII = 0;
+  if (aSource.Length() >= kFastPathMinLength) {
+    firstNonASCII = FirstNonASCII(aSource.BeginReading(), aSource.EndReading());
+  }
+
+  if (firstNonASCII == -1) {
+    // This is all ASCII, we can use the more efficient widening append.
+    return AppendASCIItoUTF16(aSource, aDest, aFallible);
+  }
+
   nsACString::const_iterator source_start, source_end;
   CalculateUTF8Length calculator;
-  copy_string(aSource.BeginReading(source_start),
-              aSource.EndReading(source_end), calculator);
+  aSource.BeginReading(source_start);
+  aSource.EndReading(source_end);
 
-  uint32_t count = calculator.Length();
+  // Skip the characters that we know are single byte.
+  source_start.advance(firstNonASCII);
+
+  copy_string(source_start, source_end, calculator);
+
+  // Include the ASCII characters that were skipped in the count.
+  uint32_t count = calculator.Length() + firstNonASCII;
 
   // Avoid making the string mutable if we're appending an empty string
   if (count) {
@@ -368,12 +442,26 @@ AppendUTF8toUTF16(const nsACString& aSource, nsAString& aDest,
 
     // All ready? Time to convert
 
-    ConvertUTF8toUTF16 converter(aDest.BeginWriting() + old_dest_length);
-    copy_string(aSource.BeginReading(source_start),
-                aSource.EndReading(source_end), converter);
+    nsACString::const_iterator ascii_end;
+    aSource.BeginReading(ascii_end);
+
+    // Use the more efficient widening converter for the ASCII portion.
+    if (firstNonASCII) {
+      LossyConvertEncoding8to16 lossy_converter(
+          aDest.BeginWriting() + old_dest_length);
+      nsACString::const_iterator ascii_start;
+      aSource.BeginReading(ascii_start);
+      ascii_end.advance(firstNonASCII);
+
+      copy_string(ascii_start, ascii_end, lossy_converter);
+    }
+
+    ConvertUTF8toUTF16 converter(
+        aDest.BeginWriting() + old_dest_length + firstNonASCII);
+    copy_string(ascii_end, aSource.EndReading(source_end), converter);
 
     NS_ASSERTION(converter.ErrorEncountered() ||
-                 converter.Length() == count,
+                 converter.Length() == count - firstNonASCII,
                  "CalculateUTF8Length produced the wrong length");
 
     if (converter.ErrorEncountered()) {
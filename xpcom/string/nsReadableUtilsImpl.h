@@ -12,6 +12,10 @@ inline bool IsASCII(char16_t aChar) {
   return (aChar & 0xFF80) == 0;
 }
 
+inline bool IsASCII(char aChar) {
+  return (aChar & 0x80) == 0;
+}
+
 /**
  * Provides a pointer before or equal to |aPtr| that is is suitably aligned.
  */
@@ -21,6 +25,22 @@ inline const char16_t* aligned(const char16_t* aPtr, const uintptr_t aMask)
       reinterpret_cast<const uintptr_t>(aPtr) & ~aMask);
 }
 
+inline const char* aligned(const char* aPtr, const uintptr_t aMask)
+{
+  return reinterpret_cast<const char*>(
+      reinterpret_cast<const uintptr_t>(aPtr) & ~aMask);
+}
+
+/**
+ * Word-sized mask of the high bit of every byte, for ASCII checking of UTF-8
+ * strings.
+ */
+inline size_t NonASCIIByteMask()
+{
+  // Truncated to 0x80808080 where size_t is 32 bits.
+  return (size_t)UINT64_C(0x8080808080808080);
+}
+
 /**
  * Structures for word-sized vectorization of ASCII checking for UTF-16
  * strings.
@@ -49,6 +69,7 @@ template<> struct NonASCIIParameters<8> {
 namespace SSE2 {
 
 int32_t FirstNonASCII(const char16_t* aBegin, const char16_t* aEnd);
+int32_t FirstNonASCII(const char* aBegin, const char* aEnd);
 
 } // namespace SSE2
 } // namespace mozilla
@@ -66,5 +66,51 @@ FirstNonASCII(const char16_t* aBegin, const char16_t* aEnd)
   return -1;
 }
 
+int32_t
+FirstNonASCII(const char* aBegin, const char* aEnd)
+{
+  const size_t kNumCharsPerVector = sizeof(__m128i);
+  const size_t kMask = NonASCIIByteMask();
+  const uintptr_t kXmmAlignMask = 0xf;
+  const uintptr_t kWordAlignMask = sizeof(size_t) - 1;
+
+  const char* idx = aBegin;
+
+  // Align ourselves to a 16-byte boundary as required by _mm_load_si128
+  for (; idx != aEnd && ((uintptr_t(idx) & kXmmAlignMask) != 0); idx++) {
+    if (!IsASCII(*idx)) {
+      return idx - aBegin;
+    }
+  }
+
+  // Check one XMM register (16 bytes) at a time. The high bit of each byte is
+  // exactly what _mm_movemask_epi8 collects.
+  const char* vectWalkEnd = aligned(aEnd, kXmmAlignMask);
+  for (; idx < vectWalkEnd; idx += kNumCharsPerVector) {
+    const __m128i vect = *reinterpret_cast<const __m128i*>(idx);
+    if (_mm_movemask_epi8(vect) != 0) {
+      return idx - aBegin;
+    }
+  }
+
+  // Check one word at a time.
+  const char* wordWalkEnd = aligned(aEnd, kWordAlignMask);
+  for (; idx < wordWalkEnd; idx += sizeof(size_t)) {
+    const size_t word = *reinterpret_cast<const size_t*>(idx);
+    if (word & kMask) {
+      return idx - aBegin;
+    }
+  }
+
+  // Take care of the remainder one character at a time.
+  for (; idx != aEnd; idx++) {
+    if (!IsASCII(*idx)) {
+      return idx - aBegin;
+    }
+  }
+
+  return -1;
+}
+
 } // namespace SSE2
 } // namespace mozilla
@@ -4,6 +4,7 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "gtest/gtest.h"
+#include "gtest/MozGTestBench.h" // For MOZ_GTEST_BENCH
 
 #include "base/message_loop.h"
 
@@ -430,4 +431,104 @@ TEST(MozPromise, MessageLoopEventTarget)
   NS_ProcessPendingEvents(nullptr);
 }
 
+TEST(MozPromise, SynchronousTaskDispatch)
+{
+  AutoTaskQueue atq;
+  RefPtr<TaskQueue> queue = atq.Queue();
+  RunOnTaskQueue(queue, [queue] () -> void {
+    bool resolved = false;
+    RefPtr<TestPromise::Private> p = new TestPromise::Private(__func__);
+    p->UseSynchronousTaskDispatch(__func__);
+    p->Then(queue, __func__,
+      [&resolved] (int aResolveValue) -> void { EXPECT_EQ(aResolveValue, 42); resolved = true; },
+      DO_FAIL);
+    EXPECT_FALSE(resolved);
+    p->Resolve(42, __func__);
+    EXPECT_TRUE(resolved);
+
+    // Then() on an already settled promise runs the callback immediately too,
+    // and so do the completion promises it creates.
+    int value = 0;
+    p->Then(queue, __func__,
+      [] (int aResolveValue) { return TestPromise::CreateAndResolve(aResolveValue + 1, __func__); },
+      DO_FAIL)
+    ->Then(queue, __func__,
+      [&value] (int aResolveValue) -> void { value = aResolveValue; },
+      DO_FAIL);
+    EXPECT_EQ(value, 43);
+
+    queue->BeginShutdown();
+  });
+}
+
+TEST(MozPromise, SynchronousTaskDispatchDepthLimit)
+{
+  // A synchronous chain longer than the depth limit doesn't run all its links
+  // on one stack; the rest of it completes from the event loop.
+  nsCOMPtr<nsISerialEventTarget> target = GetCurrentThreadSerialEventTarget();
+  RefPtr<TestPromise::Private> p = new TestPromise::Private(__func__);
+  p->UseSynchronousTaskDispatch(__func__);
+
+  const int length = 1000;
+  RefPtr<TestPromise> chain = p;
+  for (int i = 0; i < length; ++i) {
+    chain = chain->Then(target, __func__,
+      [] (int aResolveValue) { return TestPromise::CreateAndResolve(aResolveValue + 1, __func__); },
+      DO_FAIL);
+  }
+
+  int value = -1;
+  chain->Then(target, __func__,
+    [&value] (int aResolveValue) -> void { value = aResolveValue; },
+    DO_FAIL);
+  p->Resolve(0, __func__);
+  EXPECT_EQ(value, -1);
+
+  NS_ProcessPendingEvents(nullptr);
+  EXPECT_EQ(value, length);
+}
+
+// Resolves a chain of aLength completion promises and returns the final value.
+static int
+RunPromiseChain(nsISerialEventTarget* aTarget, int aLength, bool aSynchronous)
+{
+  RefPtr<TestPromise::Private> p = new TestPromise::Private(__func__);
+  if (aSynchronous) {
+    p->UseSynchronousTaskDispatch(__func__);
+  }
+
+  RefPtr<TestPromise> chain = p;
+  for (int i = 0; i < aLength; ++i) {
+    chain = chain->Then(aTarget, __func__,
+      [] (int aResolveValue) { return TestPromise::CreateAndResolve(aResolveValue + 1, __func__); },
+      DO_FAIL);
+  }
+
+  int value = -1;
+  chain->Then(aTarget, __func__,
+    [&value] (int aResolveValue) -> void { value = aResolveValue; },
+    DO_FAIL);
+  p->Resolve(0, __func__);
+
+  // Even synchronous chains dispatch a link past kMaxSynchronousDispatchDepth.
+  NS_ProcessPendingEvents(nullptr);
+  return value;
+}
+
+static void
+BenchPromiseChain(int aLength, bool aSynchronous)
+{
+  nsCOMPtr<nsISerialEventTarget> target = GetCurrentThreadSerialEventTarget();
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(RunPromiseChain(target, aLength, aSynchronous), aLength);
+  }
+}
+
+MOZ_GTEST_BENCH(MozPromise, PerfChain1, [] { BenchPromiseChain(1, false); });
+MOZ_GTEST_BENCH(MozPromise, PerfChain10, [] { BenchPromiseChain(10, false); });
+MOZ_GTEST_BENCH(MozPromise, PerfChain100, [] { BenchPromiseChain(100, false); });
+MOZ_GTEST_BENCH(MozPromise, PerfSynchronousChain1, [] { BenchPromiseChain(1, true); });
+MOZ_GTEST_BENCH(MozPromise, PerfSynchronousChain10, [] { BenchPromiseChain(10, true); });
+MOZ_GTEST_BENCH(MozPromise, PerfSynchronousChain100, [] { BenchPromiseChain(100, true); });
+
 #undef DO_FAIL
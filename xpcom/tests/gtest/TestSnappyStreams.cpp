@@ -82,6 +82,50 @@ static void TestCompressUncompress(uint32_t aNumBytes)
   }
 }
 
+// Verify that incompressible data round-trips and is stored without being
+// inflated by more than the framing overhead.
+static void TestCompressUncompressIncompressible(uint32_t aNumBytes)
+{
+  nsCOMPtr<nsIInputStream> pipeReader;
+  nsCOMPtr<nsIOutputStream> compress = CompressPipe(getter_AddRefs(pipeReader));
+  ASSERT_TRUE(compress);
+
+  // A simple LCG is random enough to defeat snappy.
+  nsTArray<char> inputData;
+  inputData.SetLength(aNumBytes);
+  uint32_t state = 12345;
+  for (uint32_t i = 0; i < aNumBytes; ++i) {
+    state = state * 1103515245 + 12345;
+    inputData[i] = static_cast<char>(state >> 24);
+  }
+
+  testing::WriteAllAndClose(compress, inputData);
+
+  nsAutoCString compressedData;
+  nsresult rv = NS_ConsumeStream(pipeReader, UINT32_MAX, compressedData);
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  // Stream identifier plus a header and CRC for every 64k block.
+  const uint32_t numChunks = (aNumBytes + 65535) / 65536;
+  ASSERT_LE(compressedData.Length(), aNumBytes + 10 + numChunks * 8);
+
+  nsCOMPtr<nsIInputStream> source;
+  rv = NS_NewCStringInputStream(getter_AddRefs(source), compressedData);
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  nsCOMPtr<nsIInputStream> uncompress =
+    new SnappyUncompressInputStream(source);
+
+  nsAutoCString outputData;
+  rv = NS_ConsumeStream(uncompress, UINT32_MAX, outputData);
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  ASSERT_EQ(inputData.Length(), outputData.Length());
+  for (uint32_t i = 0; i < inputData.Length(); ++i) {
+    EXPECT_EQ(inputData[i], outputData.get()[i]) << "Byte " << i;
+  }
+}
+
 static void TestUncompressCorrupt(const char* aCorruptData,
                                   uint32_t aCorruptLength)
 {
@@ -168,6 +212,16 @@ TEST(SnappyStream, CompressUncompress_256k_plus_13)
   TestCompressUncompress((256 * 1024) + 13);
 }
 
+TEST(SnappyStream, CompressUncompressIncompressible_1k)
+{
+  TestCompressUncompressIncompressible(1024);
+}
+
+TEST(SnappyStream, CompressUncompressIncompressible_256k_plus_13)
+{
+  TestCompressUncompressIncompressible((256 * 1024) + 13);
+}
+
 TEST(SnappyStream, UncompressCorruptStreamIdentifier)
 {
   static const char data[] = "This is not a valid compressed stream";
@@ -189,3 +243,12 @@ TEST(SnappyStream, UncompressCorruptCompressedDataContent)
   static const uint32_t dataLength = (sizeof(data) / sizeof(const char)) - 1;
   TestUncompressCorrupt(data, dataLength);
 }
+
+TEST(SnappyStream, UncompressCorruptUncompressedDataContent)
+{
+  static const char data[] = "\xff\x06\x00\x00sNaPpY" // stream identifier
+                             "\x01\x0a\x00\x00\x00\x00\x00\x00" // bad CRC
+                             "uncomp";
+  static const uint32_t dataLength = (sizeof(data) / sizeof(const char)) - 1;
+  TestUncompressCorrupt(data, dataLength);
+}
@@ -16,6 +16,7 @@
 #include "mozilla/HashFunctions.h"
 
 #include "gtest/gtest.h"
+#include "gtest/MozGTestBench.h" // For MOZ_GTEST_BENCH
 
 using namespace mozilla;
 
@@ -188,4 +189,92 @@ TEST(UTF, NonASCII16)
   NonASCII16_helper(512);
 }
 
+/**
+ * This tests the handling of a non-ascii character at various locations in a
+ * UTF-8 string that is being converted to UTF-16.
+ */
+void NonASCII8_helper(const size_t aStrSize)
+{
+  const size_t kTestSize = aStrSize;
+  const size_t kMaxASCII = 0x80;
+  const char16_t kUTF16Char = 0xC9;
+  const char kUTF8Surrogates[] = { char(0xC3), char(0x89) };
+
+  // Generate a string containing only ASCII characters.
+  nsString asciiString;
+  asciiString.SetLength(kTestSize);
+  nsCString asciiCString;
+  asciiCString.SetLength(kTestSize);
+
+  auto str_buff = asciiString.BeginWriting();
+  auto cstr_buff = asciiCString.BeginWriting();
+  for (size_t i = 0; i < kTestSize; i++) {
+    str_buff[i] = i % kMaxASCII;
+    cstr_buff[i] = i % kMaxASCII;
+  }
+
+  // An all-ASCII string converts to itself.
+  nsString asciiDest;
+  AppendUTF8toUTF16(asciiCString, asciiDest);
+  EXPECT_TRUE(asciiDest.Equals(asciiString));
+
+  // Now go through and test conversion when exactly one two-byte sequence
+  // results in a single UTF-16 character.
+  for (size_t i = 0; i < kTestSize; i++) {
+    // Setup the UTF-8 string.
+    nsCString utf8String;
+    utf8String.Append(asciiCString.BeginReading(), i);
+    for (auto& c : kUTF8Surrogates) {
+      utf8String.Append(c);
+    }
+    utf8String.Append(asciiCString.BeginReading() + i + 1, kTestSize - i - 1);
+
+    // Do the conversion, make sure the length decreased by 1.
+    nsString dest;
+    AppendUTF8toUTF16(utf8String, dest);
+    EXPECT_EQ(dest.Length(), utf8String.Length() - 1);
+
+    // Build up the expected UTF-16 string.
+    nsString expected(asciiString);
+    expected.BeginWriting()[i] = kUTF16Char;
+
+    EXPECT_TRUE(dest.Equals(expected));
+  }
+}
+
+TEST(UTF, NonASCII8)
+{
+  // Test with various string sizes to catch any special casing.
+  NonASCII8_helper(1);
+  NonASCII8_helper(8);
+  NonASCII8_helper(16);
+  NonASCII8_helper(17);
+  NonASCII8_helper(32);
+  NonASCII8_helper(512);
+}
+
+static void
+BenchAppendUTF8toUTF16(const char* aTail)
+{
+  // A mostly-ASCII payload, as typical of markup, JSON and script sources.
+  nsCString source;
+  for (int i = 0; i < 64; i++) {
+    source.AppendLiteral("{\"key\": \"some ASCII value\", \"n\": 12345},\n");
+  }
+  source.Append(aTail);
+
+  for (int i = 0; i < 20000; i++) {
+    nsString dest;
+    AppendUTF8toUTF16(source, dest);
+  }
+}
+
+MOZ_GTEST_BENCH(UTF, PerfAppendUTF8toUTF16ASCII, [] {
+  BenchAppendUTF8toUTF16("");
+});
+
+MOZ_GTEST_BENCH(UTF, PerfAppendUTF8toUTF16NonASCIITail, [] {
+  BenchAppendUTF8toUTF16("\xC3\x89t\xC3\xA9");
+});
+
 } // namespace TestUTF
@@ -7,6 +7,7 @@
 #include "IdleTaskRunner.h"
 #include "nsRefreshDriver.h"
 #include "mozilla/SystemGroup.h"
+#include "mozilla/Telemetry.h"
 #include "nsComponentManagerUtils.h"
 
 namespace mozilla {
@@ -60,6 +61,18 @@ IdleTaskRunner::Run()
   if (deadLineWasNull || ((now + mBudget) < mDeadline)) {
     CancelTimer();
     didRun = mCallback(mDeadline);
+#ifndef RELEASE_OR_BETA
+    // Running past the idle deadline delays whatever the deadline was
+    // computed for, typically the next refresh driver tick.
+    if (!deadLineWasNull && didRun) {
+      TimeStamp end = TimeStamp::Now();
+      if (end > mDeadline) {
+        Telemetry::Accumulate(Telemetry::IDLE_TASK_RUNNER_DEADLINE_OVERRUN_MS,
+                              nsDependentCString(mName),
+                              uint32_t((end - mDeadline).ToMilliseconds()));
+      }
+    }
+#endif
     // If we didn't do meaningful work, don't schedule using immediate
     // idle dispatch, since that could lead to a loop until the idle
     // period ends.
@@ -454,6 +454,22 @@ protected:
       aPromise->mMutex.AssertCurrentThreadOwns();
       MOZ_ASSERT(!aPromise->IsPending());
 
+      if (aPromise->mUseSynchronousTaskDispatch &&
+          aPromise->mSynchronousDispatchDepth < kMaxSynchronousDispatchDepth &&
+          mResponseTarget->IsOnCurrentThread()) {
+        PROMISE_LOG("%s Then() call made from %s, running synchronously [Promise=%p, ThenValue=%p]",
+                    aPromise->mValue.IsResolve() ? "Resolving" : "Rejecting", mCallSite,
+                    aPromise, this);
+        // The value is settled, so neither mThenValues nor mChainedPromises
+        // can grow while we drop the lock. Dropping it allows the callback to
+        // call Then() on this promise again.
+        RefPtr<ThenValueBase> kungFuDeathGrip = this;
+        RefPtr<MozPromise> promise = aPromise;
+        MutexAutoUnlock unlock(aPromise->mMutex);
+        DoResolveOrReject(promise->Value());
+        return;
+      }
+
       nsCOMPtr<nsIRunnable> r = new ResolveOrRejectRunnable(this, aPromise);
       PROMISE_LOG("%s Then() call made from %s [Runnable=%p, Promise=%p, ThenValue=%p]",
                   aPromise->mValue.IsResolve() ? "Resolving" : "Rejecting", mCallSite,
@@ -928,6 +944,15 @@ protected:
       // mCompletionPromise must be created before ThenInternal() to avoid race.
       RefPtr<Private> p =
         new Private("<completion promise>", true /* aIsCompletionPromise */);
+      if (mReceiver->mUseSynchronousTaskDispatch) {
+        p->UseSynchronousTaskDispatch("<completion promise>");
+        // A completion promise settled by a synchronous callback is settled
+        // one level deeper on the same stack. Past the limit the callback is
+        // dispatched instead, and the chain starts over on a fresh stack.
+        p->mSynchronousDispatchDepth =
+          mReceiver->mSynchronousDispatchDepth < kMaxSynchronousDispatchDepth
+          ? mReceiver->mSynchronousDispatchDepth + 1 : 0;
+      }
       mThenValue->mCompletionPromise = p;
       // Note ThenInternal() might nullify mCompletionPromise before return.
       // So we need to return p instead of mCompletionPromise.
@@ -1092,6 +1117,14 @@ protected:
 #endif
   bool mHaveRequest;
   const bool mIsCompletionPromise;
+  bool mUseSynchronousTaskDispatch = false;
+  // How many synchronously run callbacks may be on the stack when this promise
+  // is settled. Only meaningful with mUseSynchronousTaskDispatch.
+  uint32_t mSynchronousDispatchDepth = 0;
+  // Each synchronously run link of a chain nests Resolve(), DispatchAll() and
+  // DoResolveOrReject() on the stack, so bound how deep a chain goes before
+  // falling back to dispatching a runnable.
+  static const uint32_t kMaxSynchronousDispatchDepth = 32;
 #ifdef PROMISE_DEBUG
   void* mMagic4;
 #endif
@@ -1146,6 +1179,23 @@ public:
     mValue = Forward<ResolveOrRejectValue_>(aValue);
     DispatchAll();
   }
+
+  // If the caller and target are on the same thread, run the Then()
+  // callbacks synchronously instead of dispatching a runnable for each. This
+  // saves a runnable allocation and an event loop turn per link, which adds
+  // up for long chains, but changes the ordering consumers observe. It must be
+  // called before the promise is handed to any consumer: completion promises
+  // created by Then() on this promise inherit the setting. Since each inline
+  // link nests on the stack, a chain only runs kMaxSynchronousDispatchDepth
+  // links inline before dispatching the next one asynchronously.
+  void UseSynchronousTaskDispatch(const char* aSite)
+  {
+    PROMISE_ASSERT(mMagic1 == sMagic && mMagic2 == sMagic && mMagic3 == sMagic && mMagic4 == &mMutex);
+    MutexAutoLock lock(mMutex);
+    PROMISE_LOG("%s UseSynchronousTaskDispatch MozPromise (%p created at %s)", aSite, this, mCreationSite);
+    MOZ_ASSERT(IsPending(), "A synchronous task dispatch must be set before the promise is settled");
+    mUseSynchronousTaskDispatch = true;
+  }
 };
 
 // A generic promise type that does the trick for simple use cases.
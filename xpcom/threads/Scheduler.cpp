@@ -12,7 +12,9 @@
 #include "mozilla/CooperativeThreadPool.h"
 #include "mozilla/dom/ScriptSettings.h"
 #include "mozilla/ipc/BackgroundChild.h"
+#include "mozilla/Logging.h"
 #include "mozilla/SchedulerGroup.h"
+#include "mozilla/TimeStamp.h"
 #include "nsCycleCollector.h"
 #include "nsIThread.h"
 #include "nsPrintfCString.h"
@@ -26,6 +28,8 @@
 
 using namespace mozilla;
 
+static LazyLogModule sSchedulerLog("Scheduler");
+
 // Using the anonymous namespace here causes GCC to generate:
 // error: 'mozilla::SchedulerImpl' has a field 'mozilla::SchedulerImpl::mQueue' whose type uses the anonymous namespace
 namespace mozilla {
@@ -136,6 +140,12 @@ private:
 
   static void SwitcherThread(void* aData);
   void Switcher();
+  TimeDuration PreemptionQuantum() const;
+  void ReportPreemptionStats(const MutexAutoLock& aProofOfLock);
+
+  // How long a cooperative thread may run JS before the switcher asks it to
+  // yield.
+  static const uint32_t kPreemptionQuantumMs = 10;
 
   size_t mNumThreads;
 
@@ -205,6 +215,20 @@ private:
   static bool sUnlabeledEventRunning;
 
   JSContext* mContexts[CooperativeThreadPool::kMaxThreads];
+
+  // Preemption bookkeeping, indexed by cooperative thread and protected by
+  // mLock. mQuantumStart is when the thread last started running and
+  // mInterruptRequested is when the switcher asked it to yield (null if no
+  // request is pending).
+  struct PreemptionStats
+  {
+    TimeStamp mQuantumStart;
+    TimeStamp mInterruptRequested;
+    uint32_t mQuanta = 0;
+    TimeDuration mTotalYieldLatency;
+    TimeDuration mMaxYieldLatency;
+  };
+  PreemptionStats mPreemptionStats[CooperativeThreadPool::kMaxThreads];
 };
 
 bool SchedulerImpl::sPrefScheduler;
@@ -393,6 +417,25 @@ void
 SchedulerImpl::Interrupt(JSContext* aCx)
 {
   MutexAutoLock lock(mLock);
+
+  CooperativeThreadPool::SelectedThread threadIndex = mThreadPool->CurrentThreadIndex(lock);
+  if (threadIndex.is<size_t>()) {
+    size_t index = threadIndex.as<size_t>();
+    PreemptionStats& stats = mPreemptionStats[index];
+    if (!stats.mInterruptRequested.IsNull()) {
+      TimeDuration latency = TimeStamp::Now() - stats.mInterruptRequested;
+      stats.mInterruptRequested = TimeStamp();
+      stats.mQuanta++;
+      stats.mTotalYieldLatency += latency;
+      if (latency > stats.mMaxYieldLatency) {
+        stats.mMaxYieldLatency = latency;
+      }
+      MOZ_LOG(sSchedulerLog, LogLevel::Verbose,
+              ("Cooperative thread %zu preempted, yield latency %.3fms",
+               index, latency.ToMilliseconds()));
+    }
+  }
+
   CooperativeThreadPool::Yield(nullptr, lock);
 }
 
@@ -416,23 +459,72 @@ SchedulerImpl::YieldCallback(JSContext* aCx)
   Scheduler::sScheduler->YieldFromJS(aCx);
 }
 
+TimeDuration
+SchedulerImpl::PreemptionQuantum() const
+{
+  // Chaotic scheduling is meant for testing, so switch as much as possible
+  // without regard for performance.
+  if (sPrefChaoticScheduling) {
+    return TimeDuration();
+  }
+  return TimeDuration::FromMilliseconds(kPreemptionQuantumMs);
+}
+
 void
 SchedulerImpl::Switcher()
 {
-  // This thread switcher is extremely basic and only meant for testing. The
-  // goal is to switch as much as possible without regard for performance.
+  // Ask the running cooperative thread to yield, via the JS interrupt
+  // callback, once it has used up its time quantum. The switcher sleeps until
+  // the current quantum is due to expire rather than polling continuously.
+  const TimeDuration quantum = PreemptionQuantum();
+  const TimeDuration minWait = TimeDuration::FromMicroseconds(50);
 
   MutexAutoLock lock(mLock);
   while (!mShuttingDown) {
+    TimeDuration wait = quantum;
+
     CooperativeThreadPool::SelectedThread threadIndex = mThreadPool->CurrentThreadIndex(lock);
     if (threadIndex.is<size_t>()) {
-      JSContext* cx = mContexts[threadIndex.as<size_t>()];
-      if (cx) {
+      size_t index = threadIndex.as<size_t>();
+      PreemptionStats& stats = mPreemptionStats[index];
+      TimeStamp now = TimeStamp::Now();
+      if (stats.mQuantumStart.IsNull()) {
+        stats.mQuantumStart = now;
+      }
+
+      TimeDuration elapsed = now - stats.mQuantumStart;
+      if (elapsed < quantum) {
+        wait = quantum - elapsed;
+      } else if (JSContext* cx = mContexts[index]) {
+        if (stats.mInterruptRequested.IsNull()) {
+          stats.mInterruptRequested = now;
+        }
         JS_RequestInterruptCallbackCanWait(cx);
       }
     }
 
-    mShutdownCondVar.Wait(PR_MicrosecondsToInterval(50));
+    if (wait < minWait) {
+      wait = minWait;
+    }
+    mShutdownCondVar.Wait(PR_MicrosecondsToInterval(uint32_t(wait.ToMicroseconds())));
+  }
+}
+
+void
+SchedulerImpl::ReportPreemptionStats(const MutexAutoLock& aProofOfLock)
+{
+  if (!MOZ_LOG_TEST(sSchedulerLog, LogLevel::Debug)) {
+    return;
+  }
+
+  for (size_t i = 0; i < mNumThreads; i++) {
+    const PreemptionStats& stats = mPreemptionStats[i];
+    double meanLatency = stats.mQuanta
+                         ? stats.mTotalYieldLatency.ToMilliseconds() / stats.mQuanta
+                         : 0.0;
+    MOZ_LOG(sSchedulerLog, LogLevel::Debug,
+            ("Cooperative thread %zu: %u quanta preempted, yield latency mean %.3fms max %.3fms",
+             i, stats.mQuanta, meanLatency, stats.mMaxYieldLatency.ToMilliseconds()));
   }
 }
 
@@ -522,6 +614,9 @@ SchedulerImpl::Start()
 
     if (switcher) {
       PR_JoinThread(switcher);
+
+      MutexAutoLock mutex(mLock);
+      ReportPreemptionStats(mutex);
     }
 
     mThreadPool->Shutdown();
@@ -723,6 +818,11 @@ SchedulerImpl::ThreadController::OnSuspendThread(size_t aIndex)
 void
 SchedulerImpl::ThreadController::OnResumeThread(size_t aIndex)
 {
+  // The pool lock is held here. Start a new quantum for this thread.
+  SchedulerImpl::PreemptionStats& stats = mScheduler->mPreemptionStats[aIndex];
+  stats.mQuantumStart = TimeStamp::Now();
+  stats.mInterruptRequested = TimeStamp();
+
   xpc::ResumeCooperativeContext();
 }
 
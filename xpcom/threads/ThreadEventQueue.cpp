@@ -98,7 +98,12 @@ ThreadEventQueue<InnerQueueT>::PutEventInternal(already_AddRefed<nsIRunnable>&&
       mBaseQueue->PutEvent(event.take(), aPriority, lock);
     }
 
-    mEventsAvailable.Notify();
+    // The consumer only needs waking if it is blocked on the condvar. Most
+    // dispatches target a thread that is busy running events and will find
+    // this one without a signal.
+    if (mWaitingThreads) {
+      mEventsAvailable.Notify();
+    }
 
     // Make sure to grab the observer before dropping the lock, otherwise the
     // event that we just placed into the queue could run and eventually delete
@@ -135,7 +140,9 @@ ThreadEventQueue<InnerQueueT>::GetEvent(bool aMayWait,
       break;
     }
 
+    mWaitingThreads++;
     mEventsAvailable.Wait();
+    mWaitingThreads--;
   }
 
   return event.forget();
@@ -109,6 +109,9 @@ private:
   Mutex mLock;
   CondVar mEventsAvailable;
 
+  // Number of threads blocked in GetEvent waiting on mEventsAvailable.
+  uint32_t mWaitingThreads = 0;
+
   bool mEventsAreDoomed = false;
   nsCOMPtr<nsIThreadObserver> mObserver;
 };
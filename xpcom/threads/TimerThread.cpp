@@ -28,6 +28,23 @@ using namespace mozilla::tasktracer;
 
 NS_IMPL_ISUPPORTS(TimerThread, nsIRunnable, nsIObserver)
 
+// Timers created with one of the *_LOW_PRIORITY types may fire late by up to
+// an eighth of their delay, but no more than this, so that they can share a
+// wakeup of the timer thread with other timers instead of causing their own.
+static const uint32_t kMaxLowPriorityTimerSlackMs = 100;
+
+/* static */ TimeDuration
+TimerThread::TimerSlack(nsTimerImpl* aTimer)
+{
+  if (!aTimer->IsLowPriority()) {
+    return TimeDuration();
+  }
+
+  TimeDuration maxSlack =
+    TimeDuration::FromMilliseconds(kMaxLowPriorityTimerSlackMs);
+  return std::min(aTimer->mDelay / int64_t(8), maxSlack);
+}
+
 TimerThread::TimerThread() :
   mInitialized(false),
   mMonitor("TimerThread.mMonitor"),
@@ -418,6 +435,7 @@ TimerThread::Run()
     PRIntervalTime waitFor;
     bool forceRunThisTimer = forceRunNextTimer;
     forceRunNextTimer = false;
+    mWakeUpTime = TimeStamp();
 
     if (mSleeping) {
       // Sleep for 0.1 seconds while not firing timers.
@@ -487,7 +505,7 @@ TimerThread::Run()
       RemoveLeadingCanceledTimersInternal();
 
       if (!mTimers.IsEmpty()) {
-        TimeStamp timeout = mTimers[0]->Value()->mTimeout;
+        TimeStamp timeout = ComputeWakeUpTimeInternal(now);
 
         // Don't wait at all (even for PR_INTERVAL_NO_WAIT) if the next timer
         // is due now or overdue.
@@ -519,6 +537,7 @@ TimerThread::Run()
         if (waitFor == 0) {
           waitFor = 1;  // round up, wait the minimum time we can wait
         }
+        mWakeUpTime = timeout;
       }
 
       if (MOZ_LOG_TEST(GetTimerLog(), LogLevel::Debug)) {
@@ -562,8 +581,12 @@ TimerThread::AddTimer(nsTimerImpl* aTimer)
     return NS_ERROR_OUT_OF_MEMORY;
   }
 
-  // Awaken the timer thread.
-  if (mWaiting && mTimers[0]->Value() == aTimer) {
+  // Awaken the timer thread if the new timer must fire before the thread
+  // would otherwise wake up.
+  if (mWaiting &&
+      (mTimers[0]->Value() == aTimer ||
+       (!mWakeUpTime.IsNull() &&
+        aTimer->mTimeout + TimerSlack(aTimer) < mWakeUpTime))) {
     mNotified = true;
     mMonitor.Notify();
   }
@@ -664,6 +687,36 @@ TimerThread::FindNextFireTimeForCurrentThread(TimeStamp aDefault, uint32_t aSear
   return timeStamp;
 }
 
+// This function must be called from within a lock
+TimeStamp
+TimerThread::ComputeWakeUpTimeInternal(const TimeStamp& aNow)
+{
+  mMonitor.AssertCurrentThreadOwns();
+  MOZ_ASSERT(!mTimers.IsEmpty() && mTimers[0]->Value());
+
+  // Timers that are already due are fired right away.
+  TimeStamp first = mTimers[0]->Timeout();
+  if (first <= aNow) {
+    return first;
+  }
+
+  // Otherwise wake up at the latest time that still lets every timer fire
+  // within its slack. This is the first timer's timeout unless that timer has
+  // slack, in which case later timers may have to fire before it does.
+  TimeStamp wakeUp = mTimers[0]->LatestFiringTime();
+  if (wakeUp == first) {
+    return wakeUp;
+  }
+
+  for (const UniquePtr<Entry>& entry : mTimers) {
+    if (entry->Value() && entry->Timeout() < wakeUp) {
+      wakeUp = std::min(wakeUp, entry->LatestFiringTime());
+    }
+  }
+
+  return wakeUp;
+}
+
 // This function must be called from within a lock
 bool
 TimerThread::AddTimerInternal(nsTimerImpl* aTimer)
@@ -676,7 +729,8 @@ TimerThread::AddTimerInternal(nsTimerImpl* aTimer)
   TimeStamp now = TimeStamp::Now();
 
   UniquePtr<Entry>* entry = mTimers.AppendElement(
-    MakeUnique<Entry>(now, aTimer->mTimeout, aTimer), mozilla::fallible);
+    MakeUnique<Entry>(now, aTimer->mTimeout, TimerSlack(aTimer), aTimer),
+    mozilla::fallible);
   if (!entry) {
     return false;
   }
@@ -71,6 +71,8 @@ private:
   bool    RemoveTimerInternal(nsTimerImpl* aTimer);
   void    RemoveLeadingCanceledTimersInternal();
   void    RemoveFirstTimerInternal();
+  TimeStamp ComputeWakeUpTimeInternal(const TimeStamp& aNow);
+  static TimeDuration TimerSlack(nsTimerImpl* aTimer);
   nsresult Init();
 
   already_AddRefed<nsTimerImpl> PostTimerEvent(already_AddRefed<nsTimerImpl> aTimerRef);
@@ -83,15 +85,24 @@ private:
   bool mNotified;
   bool mSleeping;
 
+  // When the thread is waiting for the next timer, the time it is going to
+  // wake up at. Null if it is waiting without a timeout or sleeping.
+  TimeStamp mWakeUpTime;
+
   class Entry final : public nsTimerImplHolder
   {
     const TimeStamp mTimeout;
 
+    // How late the timer may fire so that it can share a wakeup with other
+    // timers. See TimerThread::TimerSlack().
+    const TimeDuration mSlack;
+
   public:
     Entry(const TimeStamp& aMinTimeout, const TimeStamp& aTimeout,
-          nsTimerImpl* aTimerImpl)
+          const TimeDuration& aSlack, nsTimerImpl* aTimerImpl)
       : nsTimerImplHolder(aTimerImpl)
       , mTimeout(std::max(aMinTimeout, aTimeout))
+      , mSlack(aSlack)
     {
     }
 
@@ -123,6 +134,11 @@ private:
     {
       return mTimeout;
     }
+
+    TimeStamp LatestFiringTime() const
+    {
+      return mTimeout + mSlack;
+    }
   };
 
   nsTArray<mozilla::UniquePtr<Entry>> mTimers;
@@ -94,7 +94,12 @@ nsThreadPool::PutEvent(already_AddRefed<nsIRunnable> aEvent, uint32_t aFlags)
     }
 
     mEvents.PutEvent(Move(aEvent), EventPriority::Normal, lock);
-    mEventsAvailable.Notify();
+    // Only idle threads can be waiting for events. Busy threads check the
+    // queue again before they go idle, so don't bother signalling when there
+    // are none; this saves a futex wake on every dispatch to a busy pool.
+    if (mIdleCount > 0) {
+      mEventsAvailable.Notify();
+    }
     stackSize = mStackSize;
   }
 